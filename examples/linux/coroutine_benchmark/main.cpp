@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/debug/logger.hpp>
+#include <modm/platform.hpp>
+#include <modm/processing/coroutine.hpp>
+#include <modm/processing/resumable.hpp>
+#include <chrono>
+
+/**
+ * Compares the switch cost and memory usage of resumable functions and
+ * coroutines for the same nested algorithm.
+ *
+ * How to use:
+ * - Do
+ *   scons run
+ *
+ * Both implementations call a nested function which yields once before
+ * returning, so every iteration suspends and resumes the outer function.
+ * Compare the code size of the `Resumable::run()` and `coroutine()` symbols
+ * with `nm --size-sort -C` on the compiled executable.
+ */
+
+static constexpr uint32_t Iterations = 10'000'000;
+
+class Resumable : public modm::NestedResumable<2>
+{
+public:
+	modm::ResumableResult<uint32_t>
+	run()
+	{
+		RF_BEGIN();
+		// locals do not survive a yield, they must be class members
+		for (index = 0; index < Iterations; ++index)
+		{
+			total = RF_CALL(step(total));
+		}
+		RF_END_RETURN(total);
+	}
+
+private:
+	modm::ResumableResult<uint32_t>
+	step(uint32_t value)
+	{
+		RF_BEGIN();
+		RF_YIELD();
+		RF_END_RETURN(value + 1);
+	}
+
+	uint32_t index;
+	uint32_t total{0};
+};
+
+modm::coro::Task<uint32_t>
+step(uint32_t value)
+{
+	co_await modm::coro::yield();
+	co_return value + 1;
+}
+
+modm::coro::Task<uint32_t>
+coroutine()
+{
+	uint32_t total{0};
+	for (uint32_t index = 0; index < Iterations; ++index)
+	{
+		total = co_await step(total);
+	}
+	co_return total;
+}
+
+template< class Run >
+void
+benchmark(const char *name, Run&& run)
+{
+	const auto start = std::chrono::steady_clock::now();
+	const uint32_t result = run();
+	const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+
+	MODM_LOG_INFO.printf("%-10s result %9u in %7.1fms = %5.2fns/switch\n",
+			name, unsigned(result), duration.count() / 1e6, duration.count() / Iterations);
+}
+
+int
+main()
+{
+	static Resumable resumable;
+	benchmark("resumable", []
+	{
+		modm::ResumableResult<uint32_t> result{0};
+		do result = resumable.run();
+		while (result.getState() > modm::rf::NestingError);
+		return result.getResult();
+	});
+	MODM_LOG_INFO.printf("resumable  state: %zu bytes\n", sizeof(resumable));
+
+	benchmark("coroutine", []
+	{
+		auto task = coroutine();
+		while (task.run()) ;
+		return task.getResult();
+	});
+	MODM_LOG_INFO.printf("coroutine  frames: %zu * %zu bytes (%zu bytes reserved)\n",
+			modm::coro::framePool.maxSize(), modm::coro::framePool.maxFrameSize(),
+			modm::coro::framePool.FrameCount * modm::coro::framePool.FrameSize);
+
+	return 0;
+}
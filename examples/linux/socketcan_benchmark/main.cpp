@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/debug/logger.hpp>
+#include <modm/platform.hpp>
+#include <modm/platform/can/socketcan.hpp>
+
+using namespace modm::platform;
+using namespace std::chrono_literals;
+
+/**
+ * Measures the SocketCAN throughput of single and batched transfers.
+ *
+ * How to use:
+ * - Create a virtual CAN interface:
+ *   sudo modprobe vcan
+ *   sudo ip link add dev vcan0 type vcan
+ *   sudo ip link set up vcan0
+ * - Do
+ *   scons run
+ *
+ * Two sockets are opened on the same interface, one sends and the other
+ * receives all frames. The latency is computed from the kernel timestamps.
+ */
+
+static constexpr size_t Frames = 100'000;
+
+SocketCan sender;
+SocketCan receiver;
+
+template< class Send, class Receive >
+void
+benchmark(const char *name, Send&& send, Receive&& receive)
+{
+	size_t sent{0}, received{0};
+	std::chrono::nanoseconds latency{};
+	SocketCan* interfaces[] = {&receiver};
+
+	const auto start = std::chrono::steady_clock::now();
+	while (received < Frames)
+	{
+		if (sent < Frames) sent += send(sent);
+		else if (not SocketCan::wait(interfaces, 100ms)) break;
+
+		const auto now = std::chrono::system_clock::now();
+		received += receive([&](const SocketCan::Timestamp& timestamp) {
+			latency += now - timestamp;
+		});
+	}
+	const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+	MODM_LOG_INFO.printf("%-8s %7zu frames in %6.3fs = %8.0f frames/s, mean latency %6.1fus\n",
+			name, received, duration.count(), received / duration.count(),
+			received ? std::chrono::duration<double, std::micro>(latency).count() / received : 0.0);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const char *device = (argc > 1) ? argv[1] : "vcan0";
+	if (not sender.open(device) or not receiver.open(device)) {
+		MODM_LOG_ERROR << "Could not open " << device << modm::endl;
+		return EXIT_FAILURE;
+	}
+
+	benchmark("single",
+		[](size_t index)
+		{
+			const modm::can::Message message(index & 0x7ff, 8, index);
+			return sender.sendMessage(message) ? 1 : 0;
+		},
+		[](auto&& record)
+		{
+			size_t count{0};
+			modm::can::Message message;
+			SocketCan::Timestamp timestamp;
+			while (receiver.getMessage(message, &timestamp)) {
+				record(timestamp);
+				count++;
+			}
+			return count;
+		});
+
+	benchmark("batched",
+		[](size_t index)
+		{
+			modm::can::Message messages[SocketCan::BatchSize];
+			const size_t count = std::min(SocketCan::BatchSize, Frames - index);
+			for (size_t ii = 0; ii < count; ++ii) {
+				messages[ii] = modm::can::Message((index + ii) & 0x7ff, 8, index + ii);
+			}
+			return sender.sendMessages({messages, count});
+		},
+		[](auto&& record)
+		{
+			size_t count{0}, received;
+			modm::can::Message messages[SocketCan::BatchSize];
+			SocketCan::Timestamp timestamps[SocketCan::BatchSize];
+			while ((received = receiver.getMessages(messages, timestamps)))
+			{
+				for (size_t ii = 0; ii < received; ++ii) record(timestamps[ii]);
+				count += received;
+			}
+			return count;
+		});
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/debug.hpp>
+#include <modm/processing.hpp>
+#include <modm/platform/core/virtual_time.hpp>
+
+using namespace std::chrono_literals;
+using modm::platform::VirtualTime;
+
+/**
+ * Simulates one hour of fibers and timers in virtual time.
+ *
+ * The fibers only sleep, so the scheduler advances the virtual time directly
+ * to the next wakeup and the example finishes in a few milliseconds.
+ */
+
+uint32_t fastCount{0};
+uint32_t slowCount{0};
+
+modm::Fiber<> fast([]
+{
+	modm::PeriodicTimer timer{10ms};
+	while (VirtualTime::now() < 1h)
+	{
+		if (timer.execute()) fastCount++;
+		modm::fiber::yield();
+	}
+});
+
+modm::Fiber<> slow([]
+{
+	while (VirtualTime::now() < 1h)
+	{
+		modm::fiber::sleep(1s);
+		slowCount++;
+	}
+});
+
+int
+main()
+{
+	const auto start = std::chrono::steady_clock::now();
+	modm::fiber::Scheduler::run();
+	const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+	MODM_LOG_INFO.printf("Simulated %us in %.1fms: %u fast and %u slow wakeups\n",
+			unsigned(std::chrono::duration_cast<std::chrono::seconds>(VirtualTime::now()).count()),
+			duration.count(), unsigned(fastCount), unsigned(slowCount));
+
+	return 0;
+}
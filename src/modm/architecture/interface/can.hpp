@@ -105,6 +105,30 @@ public:
 	sendMessage(const can::Message& message);
 
 	// Optional
+	/**
+	 * Send multiple messages in order.
+	 * Stops at the first message that cannot be sent.
+	 * @return number of messages that were sent
+	 */
+	static std::size_t
+	sendMessages(std::span<const can::Message> messages);
+
+	/**
+	 * Copy up to `messages.size()` received messages into the span.
+	 * @return number of messages that were received
+	 */
+	static std::size_t
+	getMessages(std::span<can::Message> messages);
+
+	/// Occupancy statistics of the software transmit buffer.
+	static can::QueueStatistics
+	getTransmitQueueStatistics();
+
+	/// Occupancy statistics of the software receive buffer.
+	static can::QueueStatistics
+	getReceiveQueueStatistics();
+
+
 	/// Get Receive Error Counter.
 	static uint8_t
 	getReceiveErrorCounter();
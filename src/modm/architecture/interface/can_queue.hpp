@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_CAN_QUEUE_HPP
+#define MODM_CAN_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "can_message.hpp"
+
+namespace modm::can
+{
+
+/// Occupancy statistics of a CAN message queue
+/// @ingroup modm_architecture_can
+struct QueueStatistics
+{
+	uint16_t size;		///< number of messages currently queued
+	uint16_t capacity;	///< maximum number of messages the queue can hold
+	uint16_t maxSize;	///< highest number of queued messages since the last reset
+	uint16_t overflows;	///< number of messages rejected because the queue was full
+};
+
+/**
+ * Computes the bus arbitration order of a message.
+ *
+ * A lower value wins arbitration on the bus. The key follows the bit order
+ * on the wire: the 11-bit base identifier, followed by RTR (standard) or SRR
+ * (extended), IDE, the 18-bit identifier extension and RTR (extended).
+ * Therefore a standard frame wins against an extended frame with the same
+ * base identifier and a data frame wins against a remote frame.
+ *
+ * @ingroup modm_architecture_can
+ */
+constexpr uint32_t
+arbitrationKey(const Message& message)
+{
+	const uint32_t rtr = message.isRemoteTransmitRequest() ? 1 : 0;
+	if (message.isExtended())
+	{
+		return ((message.identifier >> 18) & 0x7ff) << 21 | 0b11 << 19 |
+				(message.identifier & 0x3ffff) << 1 | rtr;
+	}
+	return (message.identifier & 0x7ff) << 21 | rtr << 20;
+}
+
+/**
+ * Transmit queue ordered by bus arbitration priority.
+ *
+ * `get()` always returns the queued message with the highest priority (see
+ * `arbitrationKey()`), messages with the same identifier are returned in the
+ * order they were pushed, so that multi-frame transfers are not reordered.
+ * A queued low priority bulk transfer therefore cannot delay a high priority
+ * message by more than the messages already handed to the hardware.
+ *
+ * Messages are never moved after insertion, only an index array is kept
+ * sorted. `push()` is linear in the number of queued messages with a higher
+ * or equal priority, `pop()` is constant time.
+ *
+ * @warning	The queue is not interrupt safe. If it is accessed from an
+ *			interrupt and the main context, `push()` must be called inside
+ *			an atomic lock.
+ *
+ * @tparam	N	maximum number of messages
+ *
+ * @ingroup modm_architecture_can
+ */
+template< std::size_t N >
+class PriorityQueue
+{
+	static_assert(N > 0, "PriorityQueue must hold at least one message!");
+	static_assert(N < 0xffff, "PriorityQueue can hold at most 65534 messages!");
+public:
+	using Index = std::conditional_t< (N >= 255), uint16_t, uint8_t >;
+	using Size = Index;
+
+public:
+	PriorityQueue()
+	{
+		for (std::size_t ii = 0; ii < N; ++ii) {
+			order[ii] = ii;
+		}
+	}
+
+	bool
+	isEmpty() const
+	{ return size == 0; }
+
+	bool
+	isNotEmpty() const
+	{ return size != 0; }
+
+	bool
+	isFull() const
+	{ return size >= N; }
+
+	bool
+	isNotFull() const
+	{ return size < N; }
+
+	Size
+	getSize() const
+	{ return size; }
+
+	static constexpr Size
+	getMaxSize()
+	{ return N; }
+
+	/// @return the message with the highest arbitration priority
+	const Message&
+	get() const
+	{ return buffer[order[size - 1]]; }
+
+	/// @return `false` if the queue is full and the message was not queued
+	bool
+	push(const Message& message)
+	{
+		if (isFull()) {
+			if (overflows < 0xffff) overflows++;
+			return false;
+		}
+		const uint32_t key = arbitrationKey(message);
+		// the index array contains the used slots in descending key order,
+		// followed by the free slots.
+		const Index slot = order[size];
+		Index position = size;
+		// move messages with higher or equal priority up, so that messages
+		// with the same key keep their FIFO order
+		while (position > 0 and keys[order[position - 1]] <= key)
+		{
+			order[position] = order[position - 1];
+			position--;
+		}
+		order[position] = slot;
+		buffer[slot] = message;
+		keys[slot] = key;
+		if (++size > maxSize) maxSize = size;
+		return true;
+	}
+
+	/// Removes the message returned by `get()`
+	void
+	pop()
+	{
+		// the slot index stays behind the used slots and is thus freed
+		if (size) size--;
+	}
+
+	QueueStatistics
+	getStatistics() const
+	{
+		return {size, N, maxSize, overflows};
+	}
+
+	/// Resets the high watermark to the current size and clears the overflow counter
+	void
+	resetStatistics()
+	{
+		maxSize = size;
+		overflows = 0;
+	}
+
+private:
+	Message buffer[N];
+	uint32_t keys[N];
+	Index order[N];
+	Index size{0};
+	Index maxSize{0};
+	uint16_t overflows{0};
+};
+
+} // namespace modm::can
+
+#endif // MODM_CAN_QUEUE_HPP
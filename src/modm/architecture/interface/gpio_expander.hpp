@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2017, Niklas Hauser
+ * Copyright (c) 2015, 2017, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -152,7 +152,8 @@ public:
  * Gpios as template arguments.
  *
  * @note For every pin access a blocking bus transfer is performed, therefore
- *       do not expect these gpios to be fast!
+ *       do not expect these gpios to be fast! Use `modm::GpioExpanderShadowPin`
+ *       to coalesce the accesses of multiple pins into one bus transfer.
  *
  * Usage:
  * @code
@@ -472,6 +473,295 @@ public:
 };
 /// @endcond
 
+/**
+ * Shadow registers for coalescing the bus accesses of any IO-expander
+ * conforming to the `modm::GpioExpander` interface.
+ *
+ * Writing pins only modifies the shadow registers and marks the expander as
+ * dirty, so that all changes made since the last call are written in a single
+ * bus transaction by `flush()`. Reading inputs returns the buffered values of
+ * the last bus read, which `update()` only refreshes after the expander
+ * signalled a change on its interrupt line via `invalidateInputs()`.
+ *
+ * Call `update()` once per main loop iteration or scheduler step:
+ *
+ * @code
+ * typedef modm::Pca9535<MyI2cMaster> Expander;
+ * Expander expander;
+ *
+ * typedef Expander::Shadow< expander > Shadow;
+ * typedef Expander::ShadowPin< expander, Expander::Pin::P0_0 > Led0;
+ * typedef Expander::ShadowPin< expander, Expander::Pin::P0_1 > Led1;
+ * typedef Expander::ShadowPin< expander, Expander::Pin::P1_0 > Button;
+ *
+ * // the INT pin of the expander signals changed inputs
+ * Exti::connect<ExpanderInt>(Exti::Trigger::FallingEdge, [](uint8_t)
+ * {
+ *     Shadow::invalidateInputs();
+ * });
+ *
+ * while (true)
+ * {
+ *     // no bus access here
+ *     Led0::set(Button::read());
+ *     Led1::toggle();
+ *
+ *     // one write transaction for both LEDs and a read only if the INT pin fired
+ *     Shadow::update();
+ * }
+ * @endcode
+ *
+ * @note All pins of the expander share the same shadow registers, however,
+ *       the direction and the configuration of the pins are still written
+ *       immediately and not coalesced. Writes to input pins are ignored.
+ *
+ * @note The shadow registers are not flushed automatically by any scheduler,
+ *       you must call `update()` or `flush()` yourself.
+ *
+ * @warning Access to the IO-expander is **blocking and can silently fail**!
+ *          A failed write is retried on the next `flush()`.
+ *
+ * @pre     The IO-expander needs to be initialized externally, if required.
+ *
+ * @tparam  GpioExpander    Type of class conforming to the `modm::GpioExpander` interface
+ * @tparam  expander        instance of the expander
+ *
+ * @ingroup modm_architecture_gpio_expander
+ * @author  Niklas Hauser
+ */
+template <
+	typename GpioExpander,
+	GpioExpander &expander >
+class GpioExpanderShadow
+{
+	using Pin = typename GpioExpander::Pin;
+	using Pins = typename GpioExpander::Pins;
+	using PortType = typename GpioExpander::PortType;
+
+public:
+	static constexpr GpioExpander &ioExpander = expander;
+
+public:
+	static void
+	set(Pins pins)
+	{
+		const PortType mask = outputs(pins);
+		if ((getOutputs() & mask) != mask) dirty = true;
+		pendingSet |= mask;
+		pendingReset &= ~mask;
+	}
+
+	static void
+	reset(Pins pins)
+	{
+		const PortType mask = outputs(pins);
+		if (getOutputs() & mask) dirty = true;
+		pendingReset |= mask;
+		pendingSet &= ~mask;
+	}
+
+	static void
+	set(Pins pins, bool value)
+	{
+		if (value) set(pins);
+		else reset(pins);
+	}
+
+	static void
+	toggle(Pins pins)
+	{
+		const PortType high = getOutputs() & pins.value;
+		set(Pins(pins.value & ~high));
+		reset(Pins(high));
+	}
+
+	static bool
+	isSet(Pin pin)
+	{
+		return getOutputs() & PortType(pin);
+	}
+
+	/// Returns the output bits including the writes not yet flushed
+	static PortType
+	getOutputs()
+	{
+		return (expander.getOutputs().value & ~pendingReset) | pendingSet;
+	}
+
+	/// Returns `true` if the outputs have changed since the last flush
+	static bool
+	isDirty()
+	{
+		return dirty;
+	}
+
+	/// Writes all changed outputs in one bus transaction.
+	/// @return `true` if the outputs were already up-to-date or were written successfully
+	static bool
+	flush()
+	{
+		if (not dirty) return true;
+
+		const PortType data = getOutputs();
+		// pins written during the transfer are flushed on the next call
+		pendingSet = pendingReset = 0;
+		dirty = false;
+
+		if (RF_CALL_BLOCKING(expander.writePort(data))) return true;
+
+		// retry the failed data, but keep the pins written during the transfer
+		pendingSet |= data & ~pendingReset;
+		pendingReset |= PortType(~data) & ~pendingSet;
+		dirty = true;
+		return false;
+	}
+
+	/// Returns the buffered input bits without bus access
+	static bool
+	read(Pin pin)
+	{
+		return expander.read(pin);
+	}
+
+	/// Marks the buffered inputs as outdated, call this from the interrupt of the expander.
+	static void
+	invalidateInputs()
+	{
+		stale = true;
+	}
+
+	/// Returns `true` if the buffered inputs need to be read again
+	static bool
+	isStale()
+	{
+		return stale;
+	}
+
+	/// Flushes the outputs and reads the inputs if they were invalidated.
+	/// @return `true` if all required bus transfers were successful
+	static bool
+	update()
+	{
+		bool success = flush();
+		if (stale)
+		{
+			// changes during the transfer are read on the next call
+			stale = false;
+			if (not RF_CALL_BLOCKING(expander.readInput()))
+			{
+				stale = true;
+				success = false;
+			}
+		}
+		return success;
+	}
+
+private:
+	/// Masks out the pins configured as inputs
+	static PortType
+	outputs(Pins pins)
+	{
+		return pins.value & expander.getDirections().value;
+	}
+
+	static inline PortType pendingSet{0};
+	static inline PortType pendingReset{0};
+	static inline bool dirty{false};
+	static inline volatile bool stale{true};
+};
+
+/**
+ * Create an `modm::GpioIO` compatible interface from the shadow registers of
+ * any IO-expander conforming to the `modm::GpioExpander` interface.
+ *
+ * In contrast to `modm::GpioExpanderPin`, writing and reading the pin does
+ * not access the bus, instead all pins are written and read together via
+ * `modm::GpioExpanderShadow::update()`.
+ *
+ * @see modm::GpioExpanderShadow
+ * @see modm::GpioIO
+ *
+ * @tparam  GpioExpander    Type of class conforming to the `modm::GpioExpander` interface
+ * @tparam  expander        instance of the expander
+ * @tparam  pin             pin identifier of desired expander pin
+ *
+ * @ingroup modm_architecture_gpio_expander
+ * @author  Niklas Hauser
+ */
+template <
+	typename GpioExpander,
+	GpioExpander &expander,
+	typename GpioExpander::Pin pin >
+class GpioExpanderShadowPin : public modm::GpioIO
+{
+public:
+	using Shadow = GpioExpanderShadow< GpioExpander, expander >;
+
+	static constexpr Direction direction = Direction::InOut;
+	static constexpr GpioExpander &ioExpander = expander;
+
+public:
+	static void
+	setOutput()
+	{
+		RF_CALL_BLOCKING(expander.setOutput(pin));
+	}
+
+	static void inline
+	setOutput(bool value)
+	{
+		set(value);
+	}
+
+	static void inline
+	set()
+	{
+		Shadow::set(pin);
+	}
+
+	static void inline
+	set(bool value)
+	{
+		Shadow::set(pin, value);
+	}
+
+	static void inline
+	reset()
+	{
+		Shadow::reset(pin);
+	}
+
+	static void inline
+	toggle()
+	{
+		Shadow::toggle(pin);
+	}
+
+	static bool inline
+	isSet()
+	{
+		return Shadow::isSet(pin);
+	}
+
+	static void
+	setInput()
+	{
+		RF_CALL_BLOCKING(expander.setInput(pin));
+	}
+
+	static bool inline
+	read()
+	{
+		return Shadow::read(pin);
+	}
+
+	static Direction
+	getDirection()
+	{
+		return expander.getDirection(pin);
+	}
+};
+
 } // modm namespace
 
 #endif // MODM_IO_EXPANDER_PIN_HPP
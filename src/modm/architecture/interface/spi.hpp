@@ -3,6 +3,7 @@
  * Copyright (c) 2010, Martin Rosekeit
  * Copyright (c) 2012-2015, Niklas Hauser
  * Copyright (c) 2013, Sascha Schade
+ * Copyright (c) 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -16,6 +17,7 @@
 #define MODM_INTERFACE_SPI_HPP
 
 #include <modm/architecture/interface/peripheral.hpp>
+#include <cstddef>
 
 namespace modm
 {
@@ -43,6 +45,31 @@ struct Spi
 		MsbFirst = 0b0,
 		LsbFirst = 0b1,
 	};
+
+	/// Chip select behaviour after a segment of a transaction
+	enum class
+	ChipSelect : uint8_t
+	{
+		Hold = 0,	///< keep asserted for the next segment
+		Toggle = 1,	///< deassert and reassert before the next segment
+	};
+
+	/**
+	 * A contiguous transfer within a scatter/gather transaction, for example
+	 * the register address or data phase of a sensor read.
+	 *
+	 * @see modm::SpiDevice::runTransaction()
+	 */
+	struct Segment
+	{
+		const uint8_t *tx;		///< transmit buffer, `nullptr` sends dummy bytes
+		uint8_t *rx;			///< receive buffer, `nullptr` discards received bytes
+		std::size_t length;
+		ChipSelect cs = ChipSelect::Hold;
+		/// delay in microseconds after the segment, while chip select is deasserted
+		/// if it is toggled.
+		uint16_t delay_us = 0;
+	};
 };
 
 } // namespace modm
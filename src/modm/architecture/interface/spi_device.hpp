@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014-2016, Niklas Hauser
+ * Copyright (c) 2014-2016, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -14,6 +14,8 @@
 
 #include "spi.hpp"
 #include "spi_master.hpp"
+#include <modm/architecture/interface/delay.hpp>
+#include <span>
 
 namespace modm
 {
@@ -56,8 +58,96 @@ protected:
 	{
 		return (SpiMaster::release(this) == 0);
 	}
+
+	/**
+	 * Executes all segments back-to-back as one transaction.
+	 *
+	 * Acquires the master, asserts the chip select (active low) and transfers
+	 * the segments in order. After each segment, the chip select is held or
+	 * toggled and the segment delay is inserted. Finally the chip select is
+	 * deasserted and the master is released.
+	 *
+	 * A segment is started immediately after the previous one completed, so
+	 * there is no scheduler round-trip between the segments, and DMA capable
+	 * masters transfer every segment via DMA.
+	 *
+	 * ```cpp
+	 * uint8_t address = Register::Data | ReadFlag;
+	 * const modm::Spi::Segment segments[] = {
+	 *     {&address, nullptr, 1},
+	 *     {nullptr, buffer, 6},
+	 * };
+	 * RF_CALL(runTransaction<Cs>(segments));
+	 * ```
+	 *
+	 * @tparam	Cs	chip select GPIO
+	 * @warning	The segments must stay valid until the transaction has finished.
+	 */
+	template< class Cs >
+	modm::ResumableResult<void>
+	runTransaction(std::span<const Spi::Segment> segments);
+
+private:
+	template< class Cs >
+	void
+	finishSegment(const Spi::Segment& segment, bool last);
+
+#ifndef MODM_RESUMABLE_IS_FIBER
+	static constexpr uint8_t Idle = 0xff;
+	uint8_t segmentIndex{Idle};
+#endif
 };
 
+template < class SpiMaster >
+template< class Cs >
+modm::ResumableResult<void>
+SpiDevice<SpiMaster>::runTransaction(std::span<const Spi::Segment> segments)
+{
+#ifdef MODM_RESUMABLE_IS_FIBER
+	while (not acquireMaster())
+		modm::fiber::yield();
+	Cs::reset();
+	for (std::size_t index = 0; index < segments.size(); ++index)
+	{
+		const Spi::Segment& segment = segments[index];
+		SpiMaster::transfer(segment.tx, segment.rx, segment.length);
+		finishSegment<Cs>(segment, index + 1 == segments.size());
+	}
+	if (releaseMaster()) Cs::set();
+#else
+	// this is a manually implemented "fast resumable function", the index of
+	// the current segment is its state.
+	if (segmentIndex == Idle)
+	{
+		if (not acquireMaster()) return {modm::rf::Running};
+		Cs::reset();
+		segmentIndex = 0;
+	}
+	while (segmentIndex < segments.size())
+	{
+		const Spi::Segment& segment = segments[segmentIndex];
+		if (SpiMaster::transfer(segment.tx, segment.rx, segment.length).getState() > modm::rf::NestingError)
+			return {modm::rf::Running};
+		finishSegment<Cs>(segment, segmentIndex + 1u == segments.size());
+		segmentIndex++;
+	}
+	segmentIndex = Idle;
+	if (releaseMaster()) Cs::set();
+	return {modm::rf::Stop};
+#endif
+}
+
+template < class SpiMaster >
+template< class Cs >
+void
+SpiDevice<SpiMaster>::finishSegment(const Spi::Segment& segment, bool last)
+{
+	const bool toggle = (segment.cs == Spi::ChipSelect::Toggle) and not last;
+	if (toggle) Cs::set();
+	if (segment.delay_us) modm::delay_us(segment.delay_us);
+	if (toggle) Cs::reset();
+}
+
 }	// namespace modm
 
 #endif // MODM_INTERFACE_SPI_DEVICE_HPP
@@ -1,6 +1,7 @@
 /*
 * Copyright (c) 2014-2017, Niklas Hauser
 * Copyright (c) 2023, Christopher Durand
+* Copyright (c) 2026, Niklas Hauser
 *
 * This file is part of the modm project.
 *
@@ -13,9 +14,17 @@
 #ifndef MODM_INTERFACE_SPI_LOCK_HPP
 #define MODM_INTERFACE_SPI_LOCK_HPP
 
+#include <array>
 #include <cstdint>
 #include <modm/architecture/interface/spi.hpp>
 
+#if defined __DOXYGEN__ || !defined MODM_SPI_LOCK_MAX_WAITERS
+/// Default number of contexts that can wait for a `modm::SpiLock`.
+/// Set to 0 to disable the waiter queue of all SPI masters.
+/// @ingroup modm_architecture_spi
+#define MODM_SPI_LOCK_MAX_WAITERS 4
+#endif
+
 namespace modm
 {
 
@@ -26,59 +35,215 @@ namespace modm
  * Inherit from this class publicly and pass the derived class as the template
  * argument, as in `class SpiMaster1 : public modm::SpiLock<SpiMaster1>`.
  *
- * @tparam	Derived SPI master derived class
+ * Contexts that fail to acquire the lock are queued in FIFO order. When the
+ * owner releases the lock, it is reserved for the oldest waiter, so that a
+ * driver that immediately acquires the bus again cannot starve the others.
+ * Other contexts are denied until the waiter claims the lock with its next
+ * call to `acquire()`. If another context is denied twice before the waiter
+ * claims the lock, the waiter missed a full polling pass and the reservation
+ * passes to the next waiter. Contexts that abandon waiting should call
+ * `cancel()` to avoid delaying the others by one pass.
+ *
+ * If the queue is full, additional contexts are denied without being queued
+ * and simply retry.
+ *
+ * The waiter queue and the statistics use `MaxWaiters` pointers and 28 bytes
+ * of RAM per SPI master (25 bytes on AVR), that is 44 bytes (33 bytes on AVR)
+ * for the default of four waiters. Setting `MaxWaiters` to zero, or
+ * `MODM_SPI_LOCK_MAX_WAITERS` for all SPI masters, disables the queue and the
+ * lock is taken by whichever context acquires it first, as before. The
+ * statistics are still collected.
+ *
+ * @tparam	Derived		SPI master derived class
+ * @tparam	MaxWaiters	number of contexts that can be queued, 0 to disable
  * @ingroup	modm_architecture_spi
  */
-template<typename Derived>
+template<typename Derived, uint8_t MaxWaiters = MODM_SPI_LOCK_MAX_WAITERS>
 class SpiLock
 {
+public:
+	/// Arbitration statistics since the last reset
+	struct Statistics
+	{
+		uint32_t acquisitions;	///< number of times a context took the lock
+		uint32_t contentions;	///< number of denied acquires
+		uint32_t handOffs;		///< number of times the lock was passed to a waiter
+		uint32_t expirations;	///< number of hand-offs not claimed in time
+		uint16_t maxHold;		///< most denied acquires during a single ownership
+		uint8_t maxWaiters;		///< longest waiter queue
+	};
+
 public:
 	static uint8_t
-	acquire(void* ctx, Spi::ConfigurationHandler handler);
+	acquire(void* ctx, Spi::ConfigurationHandler handler = nullptr);
 
 	static uint8_t
 	release(void* ctx);
 
+	/// Removes the context from the waiter queue and gives up a pending hand-off.
+	/// @return `true` if the context was waiting.
+	static bool
+	cancel(void* ctx);
+
+	/// @return number of queued contexts
+	static uint8_t
+	getWaiters()
+	{ return size; }
+
+	static const Statistics&
+	getStatistics()
+	{ return statistics; }
+
+	static void
+	resetStatistics()
+	{ statistics = {}; }
+
 private:
+	static void
+	take(void* ctx, Spi::ConfigurationHandler handler);
+
+	static void
+	handOff();
+
+	static void
+	enqueue(void* ctx);
+
 	static inline uint8_t count{0};
 	static inline void* context{nullptr};
 	static inline Spi::ConfigurationHandler configuration{nullptr};
+
+	static inline std::array<void*, MaxWaiters> waiters{};
+	static inline uint8_t head{0};
+	static inline uint8_t size{0};
+	/// first context denied since the last hand-off
+	static inline void* denied{nullptr};
+	/// denied acquires during the current ownership
+	static inline uint16_t hold{0};
+	static inline Statistics statistics{};
 };
 
-template<typename Derived>
+template<typename Derived, uint8_t MaxWaiters>
 uint8_t
-SpiLock<Derived>::acquire(void* ctx, Spi::ConfigurationHandler handler)
+SpiLock<Derived, MaxWaiters>::acquire(void* ctx, Spi::ConfigurationHandler handler)
 {
-	if (context == nullptr)
+	if (context == nullptr or (ctx == context and count == 0))
 	{
-		context = ctx;
-		count = 1;
-		// if handler is not nullptr and is different from previous configuration
-		if (handler and configuration != handler) {
-			configuration = handler;
-			configuration();
-		}
+		take(ctx, handler);
 		return 1;
 	}
 
 	if (ctx == context)
 		return ++count;
 
+	statistics.contentions++;
+	if (hold < 0xffff) hold++;
+	if (count == 0)
+	{
+		// the waiter did not claim the hand-off within one pass
+		if (ctx == denied)
+		{
+			statistics.expirations++;
+			handOff();
+			if (context == nullptr or ctx == context)
+			{
+				take(ctx, handler);
+				return 1;
+			}
+		}
+		if (denied == nullptr) denied = ctx;
+	}
+	enqueue(ctx);
 	return 0;
 }
 
-template<typename Derived>
+template<typename Derived, uint8_t MaxWaiters>
 uint8_t
-SpiLock<Derived>::release(void* ctx)
+SpiLock<Derived, MaxWaiters>::release(void* ctx)
 {
-	if (ctx == context)
+	if (ctx == context and count)
 	{
 		if (--count == 0)
-			context = nullptr;
+		{
+			if (hold > statistics.maxHold) statistics.maxHold = hold;
+			handOff();
+		}
 	}
 	return count;
 }
 
+template<typename Derived, uint8_t MaxWaiters>
+bool
+SpiLock<Derived, MaxWaiters>::cancel(void* ctx)
+{
+	if (ctx == context and count == 0)
+	{
+		handOff();
+		return true;
+	}
+	if constexpr (MaxWaiters > 0)
+	{
+		for (uint8_t ii = 0; ii < size; ++ii)
+		{
+			if (waiters[(head + ii) % MaxWaiters] != ctx) continue;
+			// close the gap by moving the younger waiters forward
+			for (; ii < size - 1; ++ii)
+				waiters[(head + ii) % MaxWaiters] = waiters[(head + ii + 1) % MaxWaiters];
+			size--;
+			return true;
+		}
+	}
+	return false;
+}
+
+template<typename Derived, uint8_t MaxWaiters>
+void
+SpiLock<Derived, MaxWaiters>::take(void* ctx, Spi::ConfigurationHandler handler)
+{
+	context = ctx;
+	count = 1;
+	hold = 0;
+	statistics.acquisitions++;
+	// if handler is not nullptr and is different from previous configuration
+	if (handler and configuration != handler) {
+		configuration = handler;
+		configuration();
+	}
+}
+
+template<typename Derived, uint8_t MaxWaiters>
+void
+SpiLock<Derived, MaxWaiters>::handOff()
+{
+	denied = nullptr;
+	if constexpr (MaxWaiters > 0)
+	{
+		if (size)
+		{
+			// reserve the lock for the oldest waiter
+			context = waiters[head];
+			head = (head + 1) % MaxWaiters;
+			size--;
+			statistics.handOffs++;
+			return;
+		}
+	}
+	context = nullptr;
+}
+
+template<typename Derived, uint8_t MaxWaiters>
+void
+SpiLock<Derived, MaxWaiters>::enqueue(void* ctx)
+{
+	if constexpr (MaxWaiters > 0)
+	{
+		if (size >= MaxWaiters) return;
+		for (uint8_t ii = 0; ii < size; ++ii)
+			if (waiters[(head + ii) % MaxWaiters] == ctx) return;
+		waiters[(head + size) % MaxWaiters] = ctx;
+		if (++size > statistics.maxWaiters) statistics.maxWaiters = size;
+	}
+}
+
 } // namespace modm
 
 #endif // MODM_INTERFACE_SPI_LOCK_HPP
@@ -74,6 +74,9 @@ public:
 	 * The configuration handler will only be called when aquiring the spi
 	 * master for the first time (if it is not a `nullptr`).
 	 *
+	 * If another context is using the spi master, this context is queued and
+	 * the master is handed off to the waiting contexts in FIFO order.
+	 *
 	 * @warning		Aquires must be balanced with releases of the **same** context!
 	 * @warning		Aquires are persistent even after calling `initialize()`!
 	 *
@@ -84,7 +84,7 @@ protected:
 	Storage callback;
 	Redirect *const redirect;
 	inline void call(const Message &msg) { redirect(msg, &callback); }
-	template< size_t, size_t > friend class Node;
+	template< size_t, size_t, size_t > friend class Node;
 };
 
 struct Response
@@ -208,7 +208,7 @@ protected:
 	Redirect *const redirect;
 
 	inline Message call(const Message &msg) { return redirect(msg, &callback); }
-	template< size_t, size_t > friend class Node;
+	template< size_t, size_t, size_t > friend class Node;
 };
 
 template< class ReturnType = void, class ErrorType = void >
@@ -265,7 +265,7 @@ protected:
 	};
 	Error syserr{Error::Ok};
 
-	template< size_t, size_t > friend class Node;
+	template< size_t, size_t, size_t > friend class Node;
 };
 
 /// @cond
@@ -318,7 +318,7 @@ protected:
 	const ReturnType *retval{nullptr};
 	Error syserr{Error::Ok};
 
-	template< size_t, size_t > friend class Node;
+	template< size_t, size_t, size_t > friend class Node;
 };
 
 template<>
@@ -364,7 +364,7 @@ protected:
 	}
 	Error syserr{Error::Ok};
 
-	template< size_t, size_t > friend class Node;
+	template< size_t, size_t, size_t > friend class Node;
 };
 /// @endcond
 /// @}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, Niklas Hauser
+ * Copyright (c) 2020, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -52,10 +52,39 @@ public:
 
 	virtual modm::ResumableResult<bool>
 	read(uint8_t *data) = 0;
+
+	/// Writes a block of bytes back-to-back and checks their loopback.
+	/// The default implementation writes the bytes one by one.
+	virtual modm::ResumableResult<bool>
+	write(const uint8_t *data, size_t length)
+	{
+#ifdef MODM_RESUMABLE_IS_FIBER
+		for (size_t index = 0; index < length; index++)
+			if (not write(data[index])) return false;
+		return true;
+#else
+		for (; block_index < length; block_index++)
+		{
+			auto result = write(data[block_index]);
+			if (result.getState() > modm::rf::NestingError)
+				return {modm::rf::Running};
+			if (not result.getResult())
+			{
+				block_index = 0;
+				return {modm::rf::Stop, false};
+			}
+		}
+		block_index = 0;
+		return {modm::rf::Stop, true};
+#endif
+	}
+
+protected:
+	size_t block_index{0};
 };
 
 template< class Uart, uint16_t TimeoutUsTx = 1000, uint16_t TimeoutUsRx = 10'000 >
-class DeviceWrapper : public Device, modm::Resumable<2>
+class DeviceWrapper : public Device, modm::Resumable<3>
 {
 public:
 	bool
@@ -97,14 +126,54 @@ public:
 		RF_END_RETURN(true);
 	}
 
+	modm::ResumableResult<bool>
+	write(const uint8_t *data, size_t length) final
+	{
+		RF_BEGIN(2);
+		tx_index = 0;
+		for (rx_index = 0; rx_index < length; rx_index++)
+		{
+			// Keep the transmit buffer filled while comparing the loopback,
+			// so that there is no turnaround gap between the bytes.
+			timeout.restart(std::chrono::microseconds(TimeoutUsTx));
+			RF_WAIT_UNTIL(fill(data, length) or Uart::hasError() or timeout.isExpired());
+			if (timeout.isExpired() or Uart::hasError() or rx_data != data[rx_index])
+			{
+				Uart::discardTransmitBuffer();
+				Uart::discardReceiveBuffer();
+				Uart::clearError();
+				RF_RETURN(false);
+			}
+		}
+		RF_END_RETURN(true);
+	}
+
+protected:
+	bool
+	fill(const uint8_t *data, size_t length)
+	{
+		while (tx_index < length and Uart::write(data[tx_index])) tx_index++;
+		return Uart::read(rx_data);
+	}
+
 protected:
 	modm::ShortPreciseTimeout timeout;
+	size_t tx_index;
+	size_t rx_index;
 	uint8_t rx_data;
 };
 
-template< size_t MaxHeapAllocation = 0 >
-class Interface : modm::Resumable<6>
+/**
+ * Encodes messages into frames on the shared medium.
+ *
+ * @tparam MaxHeapAllocation	largest message data that may be allocated on receive.
+ * @tparam TxBatchSize	size of the transmit buffer used to write several frames
+ * 		back-to-back in one block. Set to zero to disable batched transmission.
+ */
+template< size_t MaxHeapAllocation = 0, size_t TxBatchSize = 0 >
+class Interface : modm::Resumable<8>
 {
+	static_assert(TxBatchSize == 0 or TxBatchSize >= 16, "TxBatchSize must be at least 16B!");
 public:
 	Interface(Device &device)
 	:	device(device) {}
@@ -138,6 +207,60 @@ public:
 		RF_END_RETURN(InterfaceStatus::Ok);
 	}
 
+	/**
+	 * Transmits several messages back-to-back without releasing the medium.
+	 *
+	 * The frames are encoded into the transmit buffer and written in blocks,
+	 * each frame keeps its own sync sequence and CRCs, so that the receivers
+	 * parse them one after the other as usual.
+	 * Use `transmitted()` to find out how many frames were completely written
+	 * if the batch failed.
+	 */
+	modm::ResumableResult<InterfaceStatus>
+	transmit(const Message *const *messages, uint8_t count)
+	{
+		RF_BEGIN(6);
+
+		// nothing of this batch is written yet, even if the medium is busy
+		tx_sent = 0;
+		tx_length = 0;
+		if (isMediumBusy())
+			RF_RETURN(InterfaceStatus::MediumBusy);
+		isTransmitting = true;
+
+		for (tx_message = 0; tx_message < count; tx_message++)
+		{
+			// flush the buffer first, if the whole frame may not fit anymore
+			if (tx_length + encodedLength(messages[tx_message]) > TxBatchSize)
+			{
+				if (not RF_CALL(flush())) RF_RETURN(InterfaceStatus::SyncWriteFailed);
+			}
+			tx_buffer[tx_length++] = STX;
+			tx_buffer[tx_length++] = STX;
+
+			for (tx_index = 0; tx_index < messages[tx_message]->headerLength() +
+										  messages[tx_message]->dataLength(); tx_index++)
+			{
+				// only frames larger than the buffer are written in chunks
+				if (tx_length > TxBatchSize - 2)
+				{
+					if (not RF_CALL(flush())) RF_RETURN(InterfaceStatus::DataWriteFailed);
+				}
+				encode(messages[tx_message], tx_index);
+			}
+		}
+		if (not RF_CALL(flush())) RF_RETURN(InterfaceStatus::DataWriteFailed);
+		tx_sent = count;
+
+		isTransmitting = false;
+		RF_END_RETURN(InterfaceStatus::Ok);
+	}
+
+	/// @return the number of frames completely written by the last batch transmission.
+	uint8_t
+	transmitted() const
+	{ return tx_sent; }
+
 	modm::ResumableResult<InterfaceStatus>
 	receiveHeader(Message *message)
 	{
@@ -202,6 +325,43 @@ public:
 	}
 
 protected:
+	static size_t
+	encodedLength(const Message *message)
+	{
+		// two sync bytes and every byte escaped in the worst case
+		return 2 + 2 * (message->headerLength() + message->dataLength());
+	}
+
+	void
+	encode(const Message *message, uint16_t index)
+	{
+		const uint8_t data = (index < message->headerLength()) ? message->self()[index] :
+				message->get()[index - message->headerLength()];
+		if (data == STX or data == DLE) {
+			tx_buffer[tx_length++] = DLE;
+			tx_buffer[tx_length++] = data ^ 0x20;
+		}
+		else tx_buffer[tx_length++] = data;
+	}
+
+	modm::ResumableResult<bool>
+	flush()
+	{
+		RF_BEGIN(7);
+		if (tx_length)
+		{
+			if (not RF_CALL(device.write(tx_buffer, tx_length)))
+			{
+				isTransmitting = false;
+				RF_RETURN(false);
+			}
+			// all frames before the current one are now completely written
+			tx_sent = tx_message;
+			tx_length = 0;
+		}
+		RF_END_RETURN(true);
+	}
+
 	modm::ResumableResult<bool>
 	write_escaped(uint8_t data)
 	{
@@ -251,8 +411,12 @@ protected:
 
 protected:
 	Device &device;
+	uint8_t tx_buffer[TxBatchSize ? TxBatchSize : 1];
+	uint16_t tx_length;
 	uint16_t tx_index;
 	uint16_t rx_index;
+	uint8_t tx_message;
+	uint8_t tx_sent{0};
 	uint8_t tx_data;
 	uint8_t rx_data;
 	bool rx_allocated;
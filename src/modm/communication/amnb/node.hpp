@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, Niklas Hauser
+ * Copyright (c) 2020, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -19,12 +19,20 @@
 namespace modm::amnb
 {
 
-/// @author	Niklas Hauser
-/// @ingroup modm_communication_amnb
-template < size_t TxBufferSize = 2, size_t MaxHeapAllocation = 0 >
-class Node : public modm::Resumable<6>
+/**
+ * @tparam TxBufferSize	number of messages in the transmit queue.
+ * @tparam MaxHeapAllocation	largest message data that may be allocated on receive.
+ * @tparam TxBatchSize	if non-zero, all queued messages are written back-to-back
+ * 		in blocks of this size instead of one message per medium access.
+ *
+ * @author	Niklas Hauser
+ * @ingroup modm_communication_amnb
+ */
+template < size_t TxBufferSize = 2, size_t MaxHeapAllocation = 0, size_t TxBatchSize = 0 >
+class Node : public modm::Resumable<7>
 {
 	static_assert(2 <= TxBufferSize, "TxBuffer must have at least two messages!");
+	static_assert(TxBufferSize <= 0xff, "TxBuffer must have at most 255 messages!");
 public:
 	Node(Device &device, uint8_t address): interface(device), address(address)
 	{ setSeed(); }
@@ -70,7 +78,7 @@ public:
 	broadcast(uint8_t command)
 	{
 		if (tx_queue.isFull()) return false;
-		return tx_queue.push(std::move(Message(address, command, Type::Broadcast)));
+		return tx_queue.append(std::move(Message(address, command, Type::Broadcast)));
 	}
 	bool
 	broadcast(uint8_t command, const uint8_t *data, size_t length)
@@ -80,7 +88,7 @@ public:
 		uint8_t* t = msg.get<uint8_t>();
 		if (t == nullptr) return false;
 		std::memcpy(t, data, length);
-		return tx_queue.push(std::move(msg));
+		return tx_queue.append(std::move(msg));
 	}
 	template< typename T >
 	bool
@@ -142,8 +150,13 @@ protected:
 			if (not tx_queue.isEmpty())
 			{
 				RF_WAIT_WHILE(isResumableRunning(3));
-				RF_CALL(send(tx_queue.get()));
-				tx_queue.pop();
+				if (TxBatchSize) {
+					RF_CALL(sendBatch());
+				}
+				else {
+					RF_CALL(send(tx_queue.getFront()));
+					tx_queue.removeFront();
+				}
 			}
 			RF_YIELD();
 		}
@@ -156,7 +169,7 @@ protected:
 		RF_BEGIN(3);
 
 		msg.setValid();
-		tx_counter = std::min(MIN_TX_TRIES, uint8_t(msg.command() >> (8 - PRIORITY_BITS)));
+		tx_counter = txTries(msg);
 		while(1)
 		{
 			while (interface.isMediumBusy())
@@ -179,12 +192,56 @@ protected:
 		RF_END();
 	}
 
+	modm::ResumableResult<void>
+	sendBatch()
+	{
+		RF_BEGIN(6);
+
+		prepareBatch();
+		tx_counter = txTries(tx_queue.getFront());
+		while(1)
+		{
+			while (interface.isMediumBusy())
+			{
+				RF_WAIT_WHILE(interface.isMediumBusy());
+				reschedule(RESCHEDULE_MASK_SHORT);
+				RF_WAIT_UNTIL(tx_timer.isExpired());
+			}
+
+			tx_status = RF_CALL(interface.transmit(tx_batch, tx_batch_size));
+			// remove all messages that have been completely written
+			if (interface.transmitted())
+			{
+				for (uint8_t ii = 0; ii < interface.transmitted(); ii++)
+					tx_queue.removeFront();
+				if (tx_queue.isEmpty()) break;
+				tx_counter = txTries(tx_queue.getFront());
+			}
+			if (tx_status == InterfaceStatus::Ok)
+				break;
+
+			// give up on the front message, just like send() does
+			if (--tx_counter == 0) {
+				tx_queue.removeFront();
+				if (tx_queue.isEmpty()) break;
+				tx_counter = txTries(tx_queue.getFront());
+			}
+			prepareBatch();
+
+			// a collision or other write issue occurred
+			RF_WAIT_WHILE(interface.isMediumBusy());
+			reschedule(RESCHEDULE_MASK_LONG);
+			RF_WAIT_UNTIL(tx_timer.isExpired());
+		}
+		RF_END();
+	}
+
 	modm::ResumableResult<void>
 	request()
 	{
 		RF_BEGIN(4);
 
-		RF_WAIT_WHILE(isResumableRunning(3));
+		RF_WAIT_WHILE(isResumableRunning(3) or isResumableRunning(6));
 		response_status = ResponseStatus::Waiting;
 		RF_CALL(send(request_msg));
 
@@ -253,14 +310,14 @@ protected:
 								auto msg = action.call(rx_msg);
 								msg.setAddress(address);
 								msg.setCommand(action.command);
-								tx_queue.push(std::move(msg));
+								tx_queue.append(std::move(msg));
 							}
 							return true;
 						}
 					}
 					Message msg(address, rx_msg.command(), 1, Type::Error);
 					*msg.get<Error>() = Error::NoAction;
-					tx_queue.push(std::move(msg));
+					tx_queue.append(std::move(msg));
 				}
 				break;
 
@@ -280,6 +337,23 @@ protected:
 		return false;
 	}
 
+	void
+	prepareBatch()
+	{
+		// messages appended during transmission are only sent with the next batch
+		tx_batch_size = tx_queue.getSize();
+		for (uint8_t ii = 0; ii < tx_batch_size; ii++)
+		{
+			tx_queue[ii].setValid();
+			tx_batch[ii] = &tx_queue[ii];
+		}
+	}
+
+	/// higher priority messages are retried more often
+	static uint8_t
+	txTries(const Message &msg)
+	{ return std::min(MIN_TX_TRIES, uint8_t(msg.command() >> (8 - PRIORITY_BITS))); }
+
 	void
 	setSeed()
 	{ lfsr = address << 8 | (address + 1); }
@@ -297,7 +371,7 @@ protected:
 	}
 
 protected:
-	Interface<MaxHeapAllocation> interface;
+	Interface<MaxHeapAllocation, TxBatchSize> interface;
 
 	Action *const actionList{nullptr};
 	Listener *const listenerList{nullptr};
@@ -305,7 +379,8 @@ protected:
 	modm::ShortPreciseTimeout tx_timer;
 	modm::ShortTimeout response_timer;
 
-	modm::BoundedQueue<Message, TxBufferSize> tx_queue;
+	modm::BoundedDeque<Message, TxBufferSize> tx_queue;
+	const Message* tx_batch[TxBatchSize ? TxBufferSize : 1];
 	Message request_msg;
 	Message rx_msg;
 
@@ -315,6 +390,8 @@ protected:
 	uint8_t address;
 
 	uint8_t tx_counter;
+	uint8_t tx_batch_size;
+	InterfaceStatus tx_status;
 	bool is_rx_msg_for_us;
 
 	enum class ResponseStatus : uint8_t
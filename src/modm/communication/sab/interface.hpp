@@ -21,10 +21,19 @@
 
 #include "constants.hpp"
 
+#ifdef __AVR__
+	#include <util/crc16.h>
+#endif
+
 namespace modm
 {
 	namespace sab
 	{
+#ifndef __AVR__
+		/// \internal CRC-8 (1-Wire) lookup table
+		extern const uint8_t crcTable[256];
+#endif
+
 		/**
 		 * \internal
 		 * \brief	Universal base class for the SAB interface
@@ -33,19 +42,34 @@ namespace modm
 		 * 			Understanding and Using Cyclic Redundancy Checks with Maxim iButton Products</a>
 		 * \ingroup modm_communication_sab
 		 */
-		uint8_t
-		crcUpdate(uint8_t crc, uint8_t data);
+		inline uint8_t
+		crcUpdate(uint8_t crc, uint8_t data)
+		{
+#ifdef __AVR__
+			return _crc_ibutton_update(crc, data);
+#else
+			return crcTable[crc ^ data];
+#endif
+		}
 
 		/**
 		 * \brief	SAB interface
 		 *
+		 * Received frames are parsed byte-by-byte directly into a small frame
+		 * queue, so that the application can process one frame while the
+		 * next one is still arriving. Either call update() periodically to
+		 * poll the device, or call parse() from the UART receive interrupt.
+		 *
 		 * Example:
 		 * \include sab_interface.cpp
 		 *
+		 * \tparam	QueueSize	number of complete frames that can be buffered
+		 * 			in addition to the frame currently being received.
+		 *
 		 * \author	Fabian Greif
 		 * \ingroup modm_communication_sab
 		 */
-		template <typename Device>
+		template <typename Device, uint8_t QueueSize = 1>
 		class Interface
 		{
 		public:
@@ -87,7 +111,8 @@ namespace modm
 			/**
 			 * \brief	Check if a message was received
 			 *
-			 * Reset the status with a call of dropMessage().
+			 * The accessors below refer to the oldest received message,
+			 * call dropMessage() to advance to the next one.
 			 */
 			static inline bool
 			isMessageAvailable();
@@ -112,7 +137,7 @@ namespace modm
 			 * \brief	Access the data of a received message
 			 *
 			 * Data access is only valid after isMessageAvailable() returns
-			 * \c true and before any call of dropMessage() or update()
+			 * \c true and before the call of dropMessage()
 			 */
 			static inline const uint8_t *
 			getPayload();
@@ -133,11 +158,23 @@ namespace modm
 			/**
 			 * \brief	Update internal status
 			 *
-			 * Has to be called periodically. Encodes received messages.
+			 * Has to be called periodically. Parses all bytes available
+			 * from the device.
 			 */
 			static void
 			update();
 
+			/**
+			 * \brief	Parse one received byte
+			 *
+			 * Can be called directly from the UART receive interrupt instead
+			 * of using update(). Complete frames with a valid CRC are
+			 * appended to the frame queue, frames arriving while the queue
+			 * is full are discarded.
+			 */
+			static void
+			parse(uint8_t byte);
+
 		private:
 			enum State
 			{
@@ -146,11 +183,21 @@ namespace modm
 				DATA
 			};
 
-			static uint8_t buffer[maxPayloadLength + 3];
+			// keep the payload 2-byte aligned for the callbacks
+			struct alignas(2) Frame
+			{
+				uint8_t buffer[maxPayloadLength + 3];
+				uint8_t length;
+			};
+
+			// one additional frame is used for receiving
+			static Frame frames[QueueSize + 1];
+			static volatile uint8_t head;
+			static volatile uint8_t tail;
+
 			static uint8_t crc;
 			static uint8_t position;
 			static uint8_t length;
-			static uint8_t lengthOfReceivedMessage;
 
 			static State state;
 		};
@@ -16,40 +16,43 @@
 	#error	"Don't include this file directly, use 'interface.hpp' instead!"
 #endif
 
-#ifdef __AVR__
-	#include <util/crc16.h>
-#endif
-
 /*#include <modm/debug/logger.hpp>
 
 #undef MODM_LOG_LEVEL
 #define MODM_LOG_LEVEL	modm::log::DEBUG*/
 
 // ----------------------------------------------------------------------------
-template <typename Device> typename modm::sab::Interface<Device>::State \
-	modm::sab::Interface<Device>::state = SYNC;
+template <typename Device, uint8_t QueueSize>
+typename modm::sab::Interface<Device, QueueSize>::State \
+	modm::sab::Interface<Device, QueueSize>::state = SYNC;
+
+template <typename Device, uint8_t QueueSize>
+typename modm::sab::Interface<Device, QueueSize>::Frame \
+	modm::sab::Interface<Device, QueueSize>::frames[QueueSize + 1];
 
-template <typename Device> uint8_t modm::sab::Interface<Device>::buffer[maxPayloadLength + 3];
-template <typename Device> uint8_t modm::sab::Interface<Device>::crc;
-template <typename Device> uint8_t modm::sab::Interface<Device>::position;
-template <typename Device> uint8_t modm::sab::Interface<Device>::length;
-template <typename Device> uint8_t modm::sab::Interface<Device>::lengthOfReceivedMessage = 0;
+template <typename Device, uint8_t QueueSize> volatile uint8_t modm::sab::Interface<Device, QueueSize>::head = 0;
+template <typename Device, uint8_t QueueSize> volatile uint8_t modm::sab::Interface<Device, QueueSize>::tail = 0;
+template <typename Device, uint8_t QueueSize> uint8_t modm::sab::Interface<Device, QueueSize>::crc;
+template <typename Device, uint8_t QueueSize> uint8_t modm::sab::Interface<Device, QueueSize>::position;
+template <typename Device, uint8_t QueueSize> uint8_t modm::sab::Interface<Device, QueueSize>::length;
 
 // ----------------------------------------------------------------------------
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 void
-modm::sab::Interface<Device>::initialize()
+modm::sab::Interface<Device, QueueSize>::initialize()
 {
 	//Device::setBaudrate(115'200UL);
 	state = SYNC;
+	head = 0;
+	tail = 0;
 }
 
 // ----------------------------------------------------------------------------
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 void
-modm::sab::Interface<Device>::sendMessage(uint8_t address, Flags flags,
+modm::sab::Interface<Device, QueueSize>::sendMessage(uint8_t address, Flags flags,
 		uint8_t command,
 		const void *payload, uint8_t payloadLength)
 {
@@ -74,9 +77,9 @@ modm::sab::Interface<Device>::sendMessage(uint8_t address, Flags flags,
 	Device::write(crcSend);
 }
 
-template <typename Device> template <typename T>
+template <typename Device, uint8_t QueueSize> template <typename T>
 void
-modm::sab::Interface<Device>::sendMessage(uint8_t address, Flags flags,
+modm::sab::Interface<Device, QueueSize>::sendMessage(uint8_t address, Flags flags,
 		uint8_t command,
 		const T& payload)
 {
@@ -85,9 +88,9 @@ modm::sab::Interface<Device>::sendMessage(uint8_t address, Flags flags,
 			reinterpret_cast<const void *>(&payload), sizeof(T));
 }
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 void
-modm::sab::Interface<Device>::sendMessage(uint8_t address, Flags flags, uint8_t command)
+modm::sab::Interface<Device, QueueSize>::sendMessage(uint8_t address, Flags flags, uint8_t command)
 {
 	sendMessage(address, flags,
 			command,
@@ -96,112 +99,137 @@ modm::sab::Interface<Device>::sendMessage(uint8_t address, Flags flags, uint8_t
 
 // ----------------------------------------------------------------------------
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 bool
-modm::sab::Interface<Device>::isMessageAvailable()
+modm::sab::Interface<Device, QueueSize>::isMessageAvailable()
 {
-	return (lengthOfReceivedMessage != 0);
+	return (head != tail);
 }
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 uint8_t
-modm::sab::Interface<Device>::getAddress()
+modm::sab::Interface<Device, QueueSize>::getAddress()
 {
-	return (buffer[0] & 0x3f);
+	return (frames[tail].buffer[0] & 0x3f);
 }
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 uint8_t
-modm::sab::Interface<Device>::getCommand()
+modm::sab::Interface<Device, QueueSize>::getCommand()
 {
-	return buffer[1];
+	return frames[tail].buffer[1];
 }
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 bool
-modm::sab::Interface<Device>::isResponse()
+modm::sab::Interface<Device, QueueSize>::isResponse()
 {
-	return (buffer[0] & 0x80) ? true : false;
+	return (frames[tail].buffer[0] & 0x80) ? true : false;
 }
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 bool
-modm::sab::Interface<Device>::isAcknowledge()
+modm::sab::Interface<Device, QueueSize>::isAcknowledge()
 {
-	return (buffer[0] & 0x40) ? true : false;
+	return (frames[tail].buffer[0] & 0x40) ? true : false;
 }
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 const uint8_t*
-modm::sab::Interface<Device>::getPayload()
+modm::sab::Interface<Device, QueueSize>::getPayload()
 {
-	return &buffer[2];
+	return &frames[tail].buffer[2];
 }
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 uint8_t
-modm::sab::Interface<Device>::getPayloadLength()
+modm::sab::Interface<Device, QueueSize>::getPayloadLength()
 {
-	return (lengthOfReceivedMessage - 3);
+	if (head == tail) {
+		return 0;
+	}
+	return (frames[tail].length - 3);
 }
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 void
-modm::sab::Interface<Device>::dropMessage()
+modm::sab::Interface<Device, QueueSize>::dropMessage()
 {
-	lengthOfReceivedMessage = 0;
+	if (head != tail) {
+		uint8_t tmptail = tail + 1;
+		if (tmptail > QueueSize) {
+			tmptail = 0;
+		}
+		tail = tmptail;
+	}
 }
 
 // ----------------------------------------------------------------------------
 
-template <typename Device>
+template <typename Device, uint8_t QueueSize>
 void
-modm::sab::Interface<Device>::update()
+modm::sab::Interface<Device, QueueSize>::update()
 {
 	uint8_t byte;
 	while (Device::read(byte))
 	{
-		//MODM_LOG_DEBUG.printf("%02x ", byte);
-		switch (state)
-		{
-			case SYNC:
-				if (byte == syncByte) {
-					state = LENGTH;
-				}
-				break;
-
-			case LENGTH:
-				if (byte > maxPayloadLength) {
-					state = SYNC;
-				}
-				else {
-					length = byte + 3;		// +3 for header, command and crc byte
-					position = 0;
-					crc = crcUpdate(crcInitialValue, byte);
-					state = DATA;
-				}
-				break;
-
-			case DATA:
-				buffer[position] = byte;
-				crc = crcUpdate(crc, byte);
+		parse(byte);
+	}
+}
 
-				position += 1;
-				if (position >= length) {
-					if (crc == 0) {
-						lengthOfReceivedMessage = length;
-						//MODM_LOG_DEBUG << "SAB received" << modm::endl;
+template <typename Device, uint8_t QueueSize>
+void
+modm::sab::Interface<Device, QueueSize>::parse(uint8_t byte)
+{
+	//MODM_LOG_DEBUG.printf("%02x ", byte);
+	switch (state)
+	{
+		case SYNC:
+			if (byte == syncByte) {
+				state = LENGTH;
+			}
+			break;
+
+		case LENGTH:
+			if (byte > maxPayloadLength) {
+				state = SYNC;
+			}
+			else {
+				length = byte + 3;		// +3 for header, command and crc byte
+				position = 0;
+				crc = crcUpdate(crcInitialValue, byte);
+				state = DATA;
+			}
+			break;
+
+		case DATA:
+			// the frame at head is never accessed by the application
+			frames[head].buffer[position] = byte;
+			crc = crcUpdate(crc, byte);
+
+			position += 1;
+			if (position >= length) {
+				if (crc == 0) {
+					uint8_t tmphead = head + 1;
+					if (tmphead > QueueSize) {
+						tmphead = 0;
 					}
-					else {
-						//MODM_LOG_ERROR << "CRC error" << modm::endl;
+					// discard the frame if the queue is full
+					if (tmphead != tail) {
+						frames[head].length = length;
+						head = tmphead;
 					}
-					state = SYNC;
+					//MODM_LOG_DEBUG << "SAB received" << modm::endl;
+				}
+				else {
+					//MODM_LOG_ERROR << "CRC error" << modm::endl;
 				}
-				break;
-
-			default:
 				state = SYNC;
-				break;
-		}
+			}
+			break;
+
+		default:
+			state = SYNC;
+			break;
 	}
 }
@@ -2,7 +2,7 @@
  * Copyright (c) 2009, Georgi Grinshpun
  * Copyright (c) 2009-2011, Fabian Greif
  * Copyright (c) 2010, Martin Rosekeit
- * Copyright (c) 2012-2015, Niklas Hauser
+ * Copyright (c) 2012-2015, 2026, Niklas Hauser
  * Copyright (c) 2013, Sascha Schade
  * Copyright (c) 2015, Kevin Läufer
  *
@@ -31,6 +31,9 @@ namespace xpcc
 /**
  * The Dynamic Postman is a generic Postman, which allows components to
  * add Action Handlers and Event Listeners at runtime.
+ * Payloads are only delivered to handlers with a parameter of the same size,
+ * otherwise `WRONG_ACTION_PARAMETER` or `WRONG_EVENT_PARAMETER` is returned.
+ * An event is only delivered if the payload matches all of its listeners.
  * This class should be used in hosted targets only, as the static Postman generated
  * by XPCC is much more efficient.
  *
@@ -82,13 +85,17 @@ private:
 	{
 		EventCallback call;
 		EventCallbackSimple callSimple;
+		uint16_t payloadSize;
 		int8_t hasPayload;
 
 	public:
 		EventListener();
-		EventListener(EventCallback call);
+		EventListener(EventCallback call, uint16_t payloadSize);
 		EventListener(EventCallbackSimple call);
 
+		/// @return `false` if the payload size does not match the parameter
+		bool accepts(const modm::SmartPointer& payload) const;
+
 		void operator()(const Header& header, const modm::SmartPointer& payload) const;
 	};
 
@@ -96,13 +103,17 @@ private:
 	{
 		ActionCallback call;
 		ActionCallbackSimple callSimple;
+		uint16_t payloadSize;
 		int8_t hasPayload;
 
 	public:
 		ActionHandler();
-		ActionHandler(ActionCallback call);
+		ActionHandler(ActionCallback call, uint16_t payloadSize);
 		ActionHandler(ActionCallbackSimple call);
 
+		/// @return `false` if the payload size does not match the parameter
+		bool accepts(const modm::SmartPointer& payload) const;
+
 		void operator()(const ResponseHandle& response, const modm::SmartPointer& payload) const;
 	};
 
@@ -2,7 +2,7 @@
  * Copyright (c) 2009, Georgi Grinshpun
  * Copyright (c) 2009-2010, Martin Rosekeit
  * Copyright (c) 2009-2011, Fabian Greif
- * Copyright (c) 2012-2013, 2015, Niklas Hauser
+ * Copyright (c) 2012-2013, 2015, 2026, Niklas Hauser
  * Copyright (c) 2013, Sascha Schade
  * Copyright (c) 2015, Kevin Läufer
  *
@@ -30,15 +30,19 @@ xpcc::DynamicPostman::deliverPacket(const Header &header, const modm::SmartPoint
 		// EVENT
 		EventMap::const_iterator lowerBound(this->eventMap.lower_bound(header.packetIdentifier));
 		EventMap::const_iterator upperBound(this->eventMap.upper_bound(header.packetIdentifier));
-		if (lowerBound != upperBound) {
-			do {
-				lowerBound->second(header, payload);
-				lowerBound++;
+		if (lowerBound == upperBound) {
+			return NO_EVENT;
+		}
+		// reject the event before any listener is called
+		for (EventMap::const_iterator iter = lowerBound; iter != upperBound; iter++) {
+			if (not iter->second.accepts(payload)) {
+				return WRONG_EVENT_PARAMETER;
 			}
-			while (lowerBound != upperBound);
-			return OK;
 		}
-		return NO_EVENT;
+		for (; lowerBound != upperBound; lowerBound++) {
+			lowerBound->second(header, payload);
+		}
+		return OK;
 	}
 	else
 	{
@@ -49,6 +53,9 @@ xpcc::DynamicPostman::deliverPacket(const Header &header, const modm::SmartPoint
 			CallbackMap::const_iterator iterCallback(iterDestination->second.find(header.packetIdentifier));
 			if (iterCallback != iterDestination->second.end())
 			{
+				if (not iterCallback->second.accepts(payload)) {
+					return WRONG_ACTION_PARAMETER;
+				}
 				xpcc::ResponseHandle response(header);
 				iterCallback->second(response, payload);
 				return OK;
@@ -72,18 +79,25 @@ xpcc::DynamicPostman::isComponentAvailable(uint8_t component) const
 
 // ----------------------------------------------------------------------------
 xpcc::DynamicPostman::EventListener::EventListener() :
-		hasPayload(-1)
+		payloadSize(0), hasPayload(-1)
 {
 }
 
-xpcc::DynamicPostman::EventListener::EventListener(EventCallback call) :
-		call(call), hasPayload(1)
+xpcc::DynamicPostman::EventListener::EventListener(EventCallback call, uint16_t payloadSize) :
+		call(call), payloadSize(payloadSize), hasPayload(1)
 {
 }
 
 xpcc::DynamicPostman::EventListener::EventListener(EventCallbackSimple call) :
-		callSimple(call), hasPayload(0)
+		callSimple(call), payloadSize(0), hasPayload(0)
+{
+}
+
+bool
+xpcc::DynamicPostman::EventListener::accepts(const modm::SmartPointer& payload) const
 {
+	// reject payloads which do not match the parameter type
+	return hasPayload <= 0 or payload.getSize() == payloadSize;
 }
 
 void
@@ -100,18 +114,25 @@ xpcc::DynamicPostman::EventListener::operator()(
 
 // ----------------------------------------------------------------------------
 xpcc::DynamicPostman::ActionHandler::ActionHandler() :
-		hasPayload(-1)
+		payloadSize(0), hasPayload(-1)
 {
 }
 
-xpcc::DynamicPostman::ActionHandler::ActionHandler(ActionCallback call) :
-		call(call), hasPayload(1)
+xpcc::DynamicPostman::ActionHandler::ActionHandler(ActionCallback call, uint16_t payloadSize) :
+		call(call), payloadSize(payloadSize), hasPayload(1)
 {
 }
 
 xpcc::DynamicPostman::ActionHandler::ActionHandler(ActionCallbackSimple call) :
-		callSimple(call), hasPayload(0)
+		callSimple(call), payloadSize(0), hasPayload(0)
+{
+}
+
+bool
+xpcc::DynamicPostman::ActionHandler::accepts(const modm::SmartPointer& payload) const
 {
+	// reject payloads which do not match the parameter type
+	return hasPayload <= 0 or payload.getSize() == payloadSize;
 }
 
 void
@@ -54,7 +54,8 @@ xpcc::DynamicPostman::registerEventListener(const uint8_t eventId,
 							std::bind(
 									reinterpret_cast<Function>(memberFunction),
 									componentObject,
-									_1, _2)
+									_1, _2),
+							sizeof(P)
 					)
 			)
 	);
@@ -95,7 +96,8 @@ xpcc::DynamicPostman::registerActionHandler(const uint8_t componentId,
 			std::bind(
 					reinterpret_cast<Function>(memberFunction),
 					componentObject,
-					_1, _2)
+					_1, _2),
+			sizeof(P)
 	);
 
 	return true;
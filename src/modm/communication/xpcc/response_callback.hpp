@@ -3,7 +3,7 @@
  * Copyright (c) 2009-2011, Fabian Greif
  * Copyright (c) 2009, 2011, Georgi Grinshpun
  * Copyright (c) 2010, Thorsten Lajewski
- * Copyright (c) 2012-2014, Niklas Hauser
+ * Copyright (c) 2012-2014, 2026, Niklas Hauser
  * Copyright (c) 2013, Sascha Schade
  * Copyright (c) 2015, Kevin Läufer
  *
@@ -19,6 +19,7 @@
 #define	XPCC_RESPONSE_CALLBACK_HPP
 
 #include <modm/container/smart_pointer.hpp>
+#include <modm/utils/inplace_function.hpp>
 
 #include "backend/backend_interface.hpp"
 #include "communicatable.hpp"
@@ -31,6 +32,10 @@ namespace xpcc
 	 *
 	 * Is a \b Functor.
 	 *
+	 * The object and its method are stored without heap allocation inside a
+	 * `modm::inplace_function`, so that the method is called with its own
+	 * type instead of being cast to a method of `Communicatable`.
+	 *
 	 * \ingroup		modm_communication_xpcc
 	 */
 	class ResponseCallback
@@ -38,8 +43,12 @@ namespace xpcc
 	public:
 		typedef void (Communicatable::*Function)(const Header& header, const uint8_t *type);
 
+		/// Storage for the object pointer and the pointer to its method
+		static constexpr std::size_t Storage = sizeof(Communicatable *) + sizeof(Function);
+		using Callback = modm::inplace_function<void(const Header&, const uint8_t*), Storage, alignof(void*)>;
+
 	public:
-		ResponseCallback() : component(nullptr), function(nullptr) {}
+		ResponseCallback() = default;
 
 		/**
 		 * Set the method that will be called when a response is received.
@@ -48,11 +57,15 @@ namespace xpcc
 		 * \param	memberFunction	Pointer to a function of the component object
 		 */
 		template <typename C, typename P>
-		ResponseCallback(C *componentObject, void (C::*memberFunction)(const Header& header, const P* packet)) :
-			component(reinterpret_cast<Communicatable *>(componentObject)),
-			function(reinterpret_cast<Function>(memberFunction))/*,
-			packetSize(sizeof(P))*/
+		ResponseCallback(C *componentObject, void (C::*memberFunction)(const Header& header, const P* packet))
 		{
+			if (componentObject and memberFunction)
+			{
+				function = [componentObject, memberFunction](const Header& header, const uint8_t *payload)
+				{
+					(componentObject->*memberFunction)(header, reinterpret_cast<const P*>(payload));
+				};
+			}
 		}
 
 		/**
@@ -65,17 +78,21 @@ namespace xpcc
 		 * \param	memberFunction	Pointer to a function of the component object
 		 */
 		template <typename C>
-		ResponseCallback(C *componentObject, void (C::*memberFunction)(const Header& header)) :
-			component(reinterpret_cast<Communicatable *>(componentObject)),
-			function(reinterpret_cast<Function>(memberFunction))/*,
-			packetSize(0)*/
+		ResponseCallback(C *componentObject, void (C::*memberFunction)(const Header& header))
 		{
+			if (componentObject and memberFunction)
+			{
+				function = [componentObject, memberFunction](const Header& header, const uint8_t *)
+				{
+					(componentObject->*memberFunction)(header);
+				};
+			}
 		}
 
 		inline bool
 		isCallable() const
 		{
-			return component != nullptr and function != nullptr;
+			return bool(function);
 		}
 
 		/// \todo check packet size?
@@ -83,16 +100,12 @@ namespace xpcc
 		call(const Header& header, const modm::SmartPointer &payload) const
 		{
 			if (isCallable()) {
-				(component->*function)(header, payload.getPointer());
+				function(header, payload.getPointer());
 			}
-			// TODO spezieller Aufruf für packetgröße = 0, funktioniert zwar
-			// auch ohne ist aber extrem unschön!
 		}
 
 	protected:
-		Communicatable * const component;
-		Function const function;
-		/*uint8_t packetSize;*/
+		Callback function;
 	};
 
 }
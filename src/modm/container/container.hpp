@@ -16,9 +16,15 @@
 
 #include "container/linked_list.hpp"
 #include "container/doubly_linked_list.hpp"
+#include "container/intrusive_linked_list.hpp"
+#include "container/intrusive_doubly_linked_list.hpp"
+#include "container/intrusive_queue.hpp"
 
 #include "container/dynamic_array.hpp"
 
+#include "container/static_flat_hash_map.hpp"
+#include "container/static_sorted_map.hpp"
+
 #include "container/pair.hpp"
 #include "container/smart_pointer.hpp"
 
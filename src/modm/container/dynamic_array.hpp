@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2010, Fabian Greif
- * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2012, 2026, Niklas Hauser
  * Copyright (c) 2013, Martin Rosekeit
  * Copyright (c) 2014, Daniel Krebs
  * Copyright (c) 2015, Kevin Läufer
@@ -17,9 +17,13 @@
 #define MODM_DYNAMIC_ARRAY_HPP
 
 #include <cstddef>
+#include <cstring>
+#include <type_traits>
 #include <modm/utils/allocator.hpp>
 #include <initializer_list>
 #include <iterator>
+#include <ratio>
+#include <utility>
 
 namespace modm
 {
@@ -41,12 +45,24 @@ namespace modm
 	 * explicitly indicate a capacity for the dynamic array using member
 	 * function DynamicArray::reserve().
 	 *
+	 * When the capacity is exhausted, it grows geometrically by the
+	 * `GrowthFactor`, so appending is amortized constant time. Elements are
+	 * moved to the new storage, trivially copyable elements are copied as a
+	 * block.
+	 *
+	 * \tparam	GrowthFactor	`std::ratio` greater than one, by which the
+	 * 						capacity is multiplied when the array is full
+	 *
 	 * \author	Fabian Greif <fabian.greif@rwth-aachen.de>
 	 * \ingroup	modm_container
 	 */
-	template <typename T, typename Allocator = allocator::Dynamic<T> >
+	template <typename T, typename Allocator = allocator::Dynamic<T>,
+			  typename GrowthFactor = std::ratio<3, 2> >
 	class DynamicArray
 	{
+		static_assert(std::ratio_greater_v<GrowthFactor, std::ratio<1>>,
+				"GrowthFactor must be greater than one!");
+
 	public:
 		typedef std::size_t SizeType;
 	public:
@@ -85,13 +101,29 @@ namespace modm
 		DynamicArray(std::initializer_list<T> init,
 			const Allocator& allocator = Allocator());
 
+		/**
+		 * \brief	Copy constructor
+		 *
+		 * Only allocates enough storage for the elements of the other array,
+		 * not its full capacity.
+		 */
 		DynamicArray(const DynamicArray& other);
 
+		/**
+		 * \brief	Move constructor
+		 *
+		 * Takes over the storage of the other array, which is left empty.
+		 */
+		DynamicArray(DynamicArray&& other);
+
 		~DynamicArray();
 
 		DynamicArray&
 		operator = (const DynamicArray& other);
 
+		DynamicArray&
+		operator = (DynamicArray&& other);
+
 		/**
 		 * \brief	Test whether dynamic array is empty
 		 *
@@ -151,6 +183,15 @@ namespace modm
 		void
 		reserve(SizeType n);
 
+		/**
+		 * \brief	Reduce capacity to fit the size
+		 *
+		 * Reallocates the storage to hold exactly the current elements,
+		 * freeing the unused capacity.
+		 */
+		void
+		shrinkToFit();
+
 		/**
 		 * \brief	Remove all elements and set capacity to zero
 		 *
@@ -215,6 +256,22 @@ namespace modm
 		void
 		append(const T& value);
 
+		/// \brief	Add element at the end by moving it
+		void
+		append(T&& value);
+
+		/**
+		 * \brief	Construct element at the end
+		 *
+		 * Constructs a new element in place at the end of the dynamic array
+		 * from the arguments, without creating a temporary copy.
+		 *
+		 * \return	reference to the new element
+		 */
+		template <typename... Args>
+		T&
+		emplaceBack(Args&&... args);
+
 		/**
 		 * \brief	Delete last element
 		 *
@@ -381,12 +438,23 @@ namespace modm
 
 	private:
 		/*
-		 * Allocate a new buffer of size n and copy the elements from the
+		 * Allocate a new buffer of size n and move the elements from the
 		 * old buffer to the new buffer.
 		 */
 		void
 		relocate(SizeType n);
 
+		/// Move the elements into the new buffer and free the old one
+		void
+		transfer(T* newBuffer);
+
+		/// \return	the next larger capacity
+		SizeType
+		getGrowth() const;
+
+		void
+		destroyAll();
+
 		Allocator allocator;
 
 		SizeType size;
@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2009-2010, Martin Rosekeit
  * Copyright (c) 2009-2011, Fabian Greif
- * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2012, 2026, Niklas Hauser
  * Copyright (c) 2014, Daniel Krebs
  * Copyright (c) 2015, Kevin Läufer
  *
@@ -18,22 +18,22 @@
 #endif
 
 // ----------------------------------------------------------------------------
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::DynamicArray(const Allocator& alloc) :
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::DynamicArray(const Allocator& alloc) :
 	allocator(alloc),
 	size(0), capacity(0), values(0)
 {
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::DynamicArray(SizeType n, const Allocator& alloc) :
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::DynamicArray(SizeType n, const Allocator& alloc) :
 	allocator(alloc), size(0), capacity(n)
 {
 	this->values = this->allocator.allocate(n);
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::DynamicArray(SizeType n, const T& value, const Allocator& alloc) :
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::DynamicArray(SizeType n, const T& value, const Allocator& alloc) :
 	allocator(alloc), size(n), capacity(n)
 {
 	this->values = this->allocator.allocate(n);
@@ -42,8 +42,8 @@ modm::DynamicArray<T, Allocator>::DynamicArray(SizeType n, const T& value, const
 	}
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::DynamicArray(std::initializer_list<T> init, const Allocator& alloc) :
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::DynamicArray(std::initializer_list<T> init, const Allocator& alloc) :
 	allocator(alloc), size(init.size()), capacity(init.size())
 {
 	this->values = this->allocator.allocate(init.size());
@@ -54,50 +54,86 @@ modm::DynamicArray<T, Allocator>::DynamicArray(std::initializer_list<T> init, co
 	}
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::DynamicArray(const DynamicArray& other) :
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::DynamicArray(const DynamicArray& other) :
 	allocator(other.allocator),
-	size(other.size), capacity(other.capacity)
+	size(other.size), capacity(other.size), values(0)
 {
-	this->values = allocator.allocate(other.capacity);
+	if (this->capacity) {
+		this->values = allocator.allocate(this->capacity);
+	}
 	for (SizeType i = 0; i < this->size; ++i) {
 		this->allocator.construct(&this->values[i], other.values[i]);
 	}
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::~DynamicArray()
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::DynamicArray(DynamicArray&& other) :
+	allocator(std::move(other.allocator)),
+	size(other.size), capacity(other.capacity), values(other.values)
 {
-	for (SizeType i = 0; i < this->size; ++i) {
-		this->allocator.destroy(&this->values[i]);
-	}
+	other.size = 0;
+	other.capacity = 0;
+	other.values = 0;
+}
+
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::~DynamicArray()
+{
+	this->destroyAll();
 	this->allocator.deallocate(this->values);
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>&
-modm::DynamicArray<T, Allocator>::operator = (const DynamicArray& other)
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>&
+modm::DynamicArray<T, Allocator, GrowthFactor>::operator = (const DynamicArray& other)
 {
+	if (this == &other) {
+		return *this;
+	}
+	this->destroyAll();
+
+	// reuse the storage if it is large enough
+	if (this->capacity < other.size)
+	{
+		this->allocator.deallocate(this->values);
+		this->allocator = other.allocator;
+		this->capacity = other.size;
+		this->values = this->allocator.allocate(this->capacity);
+	}
+
+	this->size = other.size;
 	for (SizeType i = 0; i < this->size; ++i) {
-		this->allocator.destroy(&this->values[i]);
+		this->allocator.construct(&this->values[i], other.values[i]);
+	}
+	return *this;
+}
+
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>&
+modm::DynamicArray<T, Allocator, GrowthFactor>::operator = (DynamicArray&& other)
+{
+	if (this == &other) {
+		return *this;
 	}
+	this->destroyAll();
 	this->allocator.deallocate(this->values);
 
-	this->allocator = other.allocator;
+	this->allocator = std::move(other.allocator);
 	this->size = other.size;
 	this->capacity = other.capacity;
-	this->values = this->allocator.allocate(this->capacity);
+	this->values = other.values;
 
-	for (SizeType i = 0; i < this->size; ++i) {
-		this->allocator.construct(&this->values[i], other.values[i]);
-	}
+	other.size = 0;
+	other.capacity = 0;
+	other.values = 0;
 	return *this;
 }
 
 // ----------------------------------------------------------------------------
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 void
-modm::DynamicArray<T, Allocator>::reserve(SizeType n)
+modm::DynamicArray<T, Allocator, GrowthFactor>::reserve(SizeType n)
 {
 	if (n <= (this->capacity - this->size)) {
 		// capacity is already big enough, nothing to do.
@@ -108,14 +144,26 @@ modm::DynamicArray<T, Allocator>::reserve(SizeType n)
 	this->relocate(this->size + n);
 }
 
-// ----------------------------------------------------------------------------
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 void
-modm::DynamicArray<T, Allocator>::clear()
+modm::DynamicArray<T, Allocator, GrowthFactor>::shrinkToFit()
 {
-	for (SizeType i = 0; i < this->size; ++i) {
-		this->allocator.destroy(&this->values[i]);
+	if (this->size == this->capacity) {
+		return;
+	}
+	if (this->size == 0) {
+		this->clear();
+		return;
 	}
+	this->relocate(this->size);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Allocator, typename GrowthFactor>
+void
+modm::DynamicArray<T, Allocator, GrowthFactor>::clear()
+{
+	this->destroyAll();
 	this->allocator.deallocate(this->values);
 	this->values = 0;
 
@@ -124,39 +172,66 @@ modm::DynamicArray<T, Allocator>::clear()
 }
 
 // ----------------------------------------------------------------------------
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 void
-modm::DynamicArray<T, Allocator>::removeAll()
+modm::DynamicArray<T, Allocator, GrowthFactor>::removeAll()
 {
-	for (SizeType i = 0; i < this->size; ++i) {
-		this->allocator.destroy(&this->values[i]);
-	}
+	this->destroyAll();
 	this->size = 0;
 }
 
+template <typename T, typename Allocator, typename GrowthFactor>
+void
+modm::DynamicArray<T, Allocator, GrowthFactor>::destroyAll()
+{
+	if constexpr (not std::is_trivially_destructible_v<T>)
+	{
+		for (SizeType i = 0; i < this->size; ++i) {
+			this->allocator.destroy(&this->values[i]);
+		}
+	}
+}
+
 // ----------------------------------------------------------------------------
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 void
-modm::DynamicArray<T, Allocator>::append(const T& value)
+modm::DynamicArray<T, Allocator, GrowthFactor>::append(const T& value)
+{
+	this->emplaceBack(value);
+}
+
+template <typename T, typename Allocator, typename GrowthFactor>
+void
+modm::DynamicArray<T, Allocator, GrowthFactor>::append(T&& value)
+{
+	this->emplaceBack(std::move(value));
+}
+
+template <typename T, typename Allocator, typename GrowthFactor>
+template <typename... Args>
+T&
+modm::DynamicArray<T, Allocator, GrowthFactor>::emplaceBack(Args&&... args)
 {
 	if (this->capacity == this->size)
 	{
-		// allocate new memory if no more space is left
-		SizeType n = this->size + (this->size + 1) / 2;
-		if (n == 0) {
-			n = 1;
-		}
-		this->relocate(n);
+		// construct the new element before moving the old ones, since
+		// the arguments may refer to elements of this array
+		const SizeType n = this->getGrowth();
+		T* newBuffer = this->allocator.allocate(n);
+		this->allocator.construct(&newBuffer[this->size], std::forward<Args>(args)...);
+		this->transfer(newBuffer);
+		this->capacity = n;
+		return this->values[this->size++];
 	}
 
-	this->allocator.construct(&this->values[this->size], value);
-	++this->size;
+	this->allocator.construct(&this->values[this->size], std::forward<Args>(args)...);
+	return this->values[this->size++];
 }
 
 // ----------------------------------------------------------------------------
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 void
-modm::DynamicArray<T, Allocator>::removeBack()
+modm::DynamicArray<T, Allocator, GrowthFactor>::removeBack()
 {
 	--this->size;
 
@@ -165,42 +240,65 @@ modm::DynamicArray<T, Allocator>::removeBack()
 }
 
 // ----------------------------------------------------------------------------
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 void
-modm::DynamicArray<T, Allocator>::relocate(SizeType n)
+modm::DynamicArray<T, Allocator, GrowthFactor>::relocate(SizeType n)
 {
 	this->capacity = n;
+	this->transfer(this->allocator.allocate(n));
+}
 
-	T* newBuffer = allocator.allocate(n);
-	for (SizeType i = 0; i < this->size; ++i) {
-		this->allocator.construct(&newBuffer[i], this->values[i]);
-		this->allocator.destroy(&this->values[i]);
+template <typename T, typename Allocator, typename GrowthFactor>
+void
+modm::DynamicArray<T, Allocator, GrowthFactor>::transfer(T* newBuffer)
+{
+	if constexpr (std::is_trivially_copyable_v<T>)
+	{
+		if (this->size) {
+			std::memcpy(static_cast<void*>(newBuffer), this->values, this->size * sizeof(T));
+		}
+	}
+	else
+	{
+		for (SizeType i = 0; i < this->size; ++i) {
+			this->allocator.construct(&newBuffer[i], std::move(this->values[i]));
+			this->allocator.destroy(&this->values[i]);
+		}
 	}
 	this->allocator.deallocate(this->values);
 
 	this->values = newBuffer;
 }
 
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::SizeType
+modm::DynamicArray<T, Allocator, GrowthFactor>::getGrowth() const
+{
+	// geometric growth rounded up, but at least by one element
+	const SizeType n = (this->capacity * GrowthFactor::num + GrowthFactor::den - 1) / GrowthFactor::den;
+	return (n > this->capacity) ? n : this->capacity + 1;
+}
+
 // ----------------------------------------------------------------------------
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::iterator
-modm::DynamicArray<T, Allocator>::begin()
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::iterator
+modm::DynamicArray<T, Allocator, GrowthFactor>::begin()
 {
 	return iterator(this, 0);
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::iterator
-modm::DynamicArray<T, Allocator>::end()
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::iterator
+modm::DynamicArray<T, Allocator, GrowthFactor>::end()
 {
 	return iterator(this, size);
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::iterator
-modm::DynamicArray<T, Allocator>::find(const T& value)
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::iterator
+modm::DynamicArray<T, Allocator, GrowthFactor>::find(const T& value)
 {
-	modm::DynamicArray<T, Allocator>::iterator iter = this->begin();
+	modm::DynamicArray<T, Allocator, GrowthFactor>::iterator iter = this->begin();
 
 	for(; iter != this->end(); ++iter)
 	{
@@ -213,25 +311,25 @@ modm::DynamicArray<T, Allocator>::find(const T& value)
 	return iter;
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::const_iterator
-modm::DynamicArray<T, Allocator>::begin() const
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator
+modm::DynamicArray<T, Allocator, GrowthFactor>::begin() const
 {
 	return const_iterator(this, 0);
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::const_iterator
-modm::DynamicArray<T, Allocator>::end() const
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator
+modm::DynamicArray<T, Allocator, GrowthFactor>::end() const
 {
 	return const_iterator(this, size);
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::const_iterator
-modm::DynamicArray<T, Allocator>::find(const T& value) const
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator
+modm::DynamicArray<T, Allocator, GrowthFactor>::find(const T& value) const
 {
-	modm::DynamicArray<T, Allocator>::const_iterator iter = this->begin();
+	modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator iter = this->begin();
 
 	for(; iter != this->end(); ++iter)
 	{
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2010-2011, Fabian Greif
- * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2012, 2026, Niklas Hauser
  * Copyright (c) 2013, Sascha Schade
  * Copyright (c) 2014, Daniel Krebs
  *
@@ -21,40 +21,40 @@
 // ----------------------------------------------------------------------------
 
 // const iterator
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::const_iterator::const_iterator() :
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::const_iterator() :
 	parent(0),
 	index(0)
 {
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::const_iterator::const_iterator(
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::const_iterator(
 		const DynamicArray* inParent, SizeType inIndex) :
 	parent(inParent),
 	index(inIndex)
 {
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::const_iterator::const_iterator(
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::const_iterator(
 		const iterator& other) :
 	parent(other.parent),
 	index(other.index)
 {
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::const_iterator::const_iterator(
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::const_iterator(
 		const const_iterator& other) :
 	parent(other.parent),
 	index(other.index)
 {
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::const_iterator&
-modm::DynamicArray<T, Allocator>::const_iterator::operator = (
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator&
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::operator = (
 		const const_iterator& other)
 {
 	this->parent = other.parent;
@@ -62,133 +62,133 @@ modm::DynamicArray<T, Allocator>::const_iterator::operator = (
 	return *this;
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::const_iterator&
-modm::DynamicArray<T, Allocator>::const_iterator::operator ++ ()
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator&
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::operator ++ ()
 {
 	++this->index;
 	return *this;
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::const_iterator&
-modm::DynamicArray<T, Allocator>::const_iterator::operator -- ()
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator&
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::operator -- ()
 {
 	--this->index;
 	return *this;
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 bool
-modm::DynamicArray<T, Allocator>::const_iterator::operator == (
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::operator == (
 		const const_iterator& other) const
 {
 	return ((parent == other.parent) &&
 			(index == other.index));
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 bool
-modm::DynamicArray<T, Allocator>::const_iterator::operator != (
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::operator != (
 		const const_iterator& other) const
 {
 	return ((parent != other.parent) ||
 			(index != other.index));
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 const T&
-modm::DynamicArray<T, Allocator>::const_iterator::operator * () const
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::operator * () const
 {
 	return parent->values[index];
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 const T*
-modm::DynamicArray<T, Allocator>::const_iterator::operator -> () const
+modm::DynamicArray<T, Allocator, GrowthFactor>::const_iterator::operator -> () const
 {
 	return &parent->values[index];
 }
 
 // ----------------------------------------------------------------------------
 // iterator
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::iterator::iterator() :
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::iterator() :
 	parent(0),
 	index(0)
 {
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::iterator::iterator(
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::iterator(
 		DynamicArray* inParent, SizeType inIndex) :
 	parent(inParent),
 	index(inIndex)
 {
 }
 
-template <typename T, typename Allocator>
-modm::DynamicArray<T, Allocator>::iterator::iterator(const iterator& other) :
+template <typename T, typename Allocator, typename GrowthFactor>
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::iterator(const iterator& other) :
 	parent(other.parent),
 	index(other.index)
 {
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::iterator&
-modm::DynamicArray<T, Allocator>::iterator::operator = (const iterator& other)
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::iterator&
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::operator = (const iterator& other)
 {
 	this->parent = other.parent;
 	this->index = other.index;
 	return *this;
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::iterator&
-modm::DynamicArray<T, Allocator>::iterator::operator ++ ()
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::iterator&
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::operator ++ ()
 {
 	++index;
 	return *this;
 }
 
-template <typename T, typename Allocator>
-typename modm::DynamicArray<T, Allocator>::iterator&
-modm::DynamicArray<T, Allocator>::iterator::operator -- ()
+template <typename T, typename Allocator, typename GrowthFactor>
+typename modm::DynamicArray<T, Allocator, GrowthFactor>::iterator&
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::operator -- ()
 {
 	--index;
 	return *this;
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 bool
-modm::DynamicArray<T, Allocator>::iterator::operator == (
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::operator == (
 		const iterator& other) const
 {
 	return ((parent == other.parent) &&
 			(index == other.index));
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 bool
-modm::DynamicArray<T, Allocator>::iterator::operator != (
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::operator != (
 		const iterator& other) const
 {
 	return ((parent != other.parent) ||
 			(index != other.index));
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 bool
-modm::DynamicArray<T, Allocator>::iterator::operator < (
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::operator < (
 		const iterator& other) const
 {
 	return ((parent == other.parent) &&
 			(index < other.index));
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 bool
-modm::DynamicArray<T, Allocator>::iterator::operator > (
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::operator > (
 		const iterator& other) const
 {
 	return ((parent == other.parent) &&
@@ -196,16 +196,16 @@ modm::DynamicArray<T, Allocator>::iterator::operator > (
 }
 
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 T&
-modm::DynamicArray<T, Allocator>::iterator::operator * ()
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::operator * ()
 {
 	return parent->values[index];
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthFactor>
 T*
-modm::DynamicArray<T, Allocator>::iterator::operator -> ()
+modm::DynamicArray<T, Allocator, GrowthFactor>::iterator::operator -> ()
 {
 	return &parent->values[index];
 }
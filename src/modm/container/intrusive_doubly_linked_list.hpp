@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	MODM_INTRUSIVE_DOUBLY_LINKED_LIST_HPP
+#define	MODM_INTRUSIVE_DOUBLY_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace modm
+{
+	/**
+	 * \brief	Hook of an element of `modm::IntrusiveDoublyLinkedList`
+	 *
+	 * Inherit from the hook to make a class linkable. Use different tags to
+	 * link the same element into several lists at once.
+	 *
+	 * The element can unlink itself in O(1) without knowing its list, and is
+	 * unlinked automatically when it is destroyed.
+	 * Copying an element does not copy its links.
+	 *
+	 * \tparam	Tag	distinguishes multiple hooks in the same class
+	 * \ingroup	modm_container
+	 */
+	template < typename Tag = void >
+	class IntrusiveDoublyLinkedListHook
+	{
+		template < typename, typename > friend class IntrusiveDoublyLinkedList;
+
+	public:
+		IntrusiveDoublyLinkedListHook() = default;
+		IntrusiveDoublyLinkedListHook(const IntrusiveDoublyLinkedListHook&) {}
+		IntrusiveDoublyLinkedListHook&
+		operator = (const IntrusiveDoublyLinkedListHook&) { return *this; }
+
+		~IntrusiveDoublyLinkedListHook()
+		{ unlink(); }
+
+		/// \return `true` if the element is in a list
+		bool
+		isLinked() const
+		{ return next != nullptr; }
+
+		/// Removes the element from its list, O(1)
+		void
+		unlink()
+		{
+			if (next == nullptr) return;
+			previous->next = next;
+			next->previous = previous;
+			next = previous = nullptr;
+		}
+
+	private:
+		IntrusiveDoublyLinkedListHook* previous{nullptr};
+		IntrusiveDoublyLinkedListHook* next{nullptr};
+	};
+
+	/**
+	 * \brief	Intrusive doubly-linked list
+	 *
+	 * The links are stored in the elements, which must inherit from
+	 * `modm::IntrusiveDoublyLinkedListHook<Tag>`. Therefore the list never
+	 * allocates memory and all operations except `getSize()` are O(1),
+	 * including removing an element from the middle of the list.
+	 * The list does not own the elements, it unlinks all of them when it is
+	 * destroyed.
+	 *
+	 * The interface follows `modm::DoublyLinkedList`, but takes elements by
+	 * reference instead of copying them.
+	 *
+	 * The list is not thread-safe, but none of the operations allocate or
+	 * block, so it can be used from interrupts within a `modm::atomic::Lock`.
+	 *
+	 * \tparam	T	type of list entries
+	 * \tparam	Tag	tag of the hook to use
+	 * \ingroup	modm_container
+	 */
+	template < typename T, typename Tag = void >
+	class IntrusiveDoublyLinkedList
+	{
+		using Hook = IntrusiveDoublyLinkedListHook<Tag>;
+
+	public:
+		template < bool Const >
+		class Iterator
+		{
+			friend class IntrusiveDoublyLinkedList;
+			friend class Iterator<not Const>;
+			using HookPtr = std::conditional_t<Const, const Hook*, Hook*>;
+
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<Const, const T*, T*>;
+			using reference = std::conditional_t<Const, const T&, T&>;
+
+			Iterator() = default;
+			/// Converts an iterator into a const iterator
+			template < bool OtherConst > requires (Const and not OtherConst)
+			Iterator(const Iterator<OtherConst>& other) : node(other.node) {}
+
+			Iterator&
+			operator ++ ()
+			{ node = node->next; return *this; }
+
+			Iterator
+			operator ++ (int)
+			{ Iterator previous(*this); node = node->next; return previous; }
+
+			Iterator&
+			operator -- ()
+			{ node = node->previous; return *this; }
+
+			Iterator
+			operator -- (int)
+			{ Iterator next(*this); node = node->previous; return next; }
+
+			bool
+			operator == (const Iterator& other) const
+			{ return node == other.node; }
+
+			reference
+			operator * () const
+			{ return *static_cast<pointer>(node); }
+
+			pointer
+			operator -> () const
+			{ return static_cast<pointer>(node); }
+
+		private:
+			explicit Iterator(HookPtr node) : node(node) {}
+			HookPtr node{nullptr};
+		};
+
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+	public:
+		IntrusiveDoublyLinkedList()
+		{
+			static_assert(std::is_base_of_v<Hook, T>,
+					"T must inherit from modm::IntrusiveDoublyLinkedListHook<Tag>!");
+			// the root is the sentinel of the circular list
+			root.next = root.previous = &root;
+		}
+
+		~IntrusiveDoublyLinkedList()
+		{ removeAll(); }
+
+		IntrusiveDoublyLinkedList(const IntrusiveDoublyLinkedList&) = delete;
+		IntrusiveDoublyLinkedList&
+		operator = (const IntrusiveDoublyLinkedList&) = delete;
+
+		/// check if there are any elements in the list
+		bool
+		isEmpty() const
+		{ return root.next == &root; }
+
+		/// Number of elements, O(n)
+		std::size_t
+		getSize() const
+		{
+			std::size_t size = 0;
+			for (const Hook* node = root.next; node != &root; node = node->next) size++;
+			return size;
+		}
+
+		/// Insert in front, unlinking the element from its previous list
+		void
+		prepend(T& value)
+		{ link(root.next, value); }
+
+		/// Insert at the end of the list, unlinking the element from its previous list
+		void
+		append(T& value)
+		{ link(&root, value); }
+
+		/// Insert before the position, unlinking the element from its previous list
+		void
+		insert(const_iterator position, T& value)
+		{ link(const_cast<Hook*>(position.node), value); }
+
+		/// Unlink the first element
+		void
+		removeFront()
+		{ root.next->unlink(); }
+
+		/// Unlink the last element
+		void
+		removeBack()
+		{ root.previous->unlink(); }
+
+		/// Unlink all elements
+		void
+		removeAll()
+		{
+			while (not isEmpty()) removeFront();
+		}
+
+		/// Unlinks the element, which must be in this list, O(1)
+		void
+		remove(T& value)
+		{ static_cast<Hook&>(value).unlink(); }
+
+		/// Unlinks the element at the position.
+		/// \return iterator to the element behind the removed one
+		iterator
+		erase(iterator position)
+		{
+			Hook* next = position.node->next;
+			position.node->unlink();
+			return iterator(next);
+		}
+
+		/// \return the first element in the list
+		T&
+		getFront() { return *static_cast<T*>(root.next); }
+
+		const T&
+		getFront() const { return *static_cast<const T*>(root.next); }
+
+		/// \return the last element in the list
+		T&
+		getBack() { return *static_cast<T*>(root.previous); }
+
+		const T&
+		getBack() const { return *static_cast<const T*>(root.previous); }
+
+		iterator
+		begin() { return iterator(root.next); }
+
+		const_iterator
+		begin() const { return const_iterator(root.next); }
+
+		iterator
+		end() { return iterator(&root); }
+
+		const_iterator
+		end() const { return const_iterator(&root); }
+
+	private:
+		/// Links the value before the node
+		void
+		link(Hook* node, T& value)
+		{
+			Hook* hook = &value;
+			hook->unlink();
+			hook->next = node;
+			hook->previous = node->previous;
+			node->previous->next = hook;
+			node->previous = hook;
+		}
+
+		Hook root;
+	};
+}
+
+#endif	// MODM_INTRUSIVE_DOUBLY_LINKED_LIST_HPP
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	MODM_INTRUSIVE_LINKED_LIST_HPP
+#define	MODM_INTRUSIVE_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace modm
+{
+	/**
+	 * \brief	Hook of an element of `modm::IntrusiveLinkedList`
+	 *
+	 * Inherit from the hook to make a class linkable. Use different tags to
+	 * link the same element into several lists at once.
+	 * Copying an element does not copy its links.
+	 *
+	 * \tparam	Tag	distinguishes multiple hooks in the same class
+	 * \ingroup	modm_container
+	 */
+	template < typename Tag = void >
+	class IntrusiveLinkedListHook
+	{
+		template < typename, typename > friend class IntrusiveLinkedList;
+		template < typename, typename > friend class IntrusiveQueue;
+
+	public:
+		IntrusiveLinkedListHook() = default;
+		IntrusiveLinkedListHook(const IntrusiveLinkedListHook&) {}
+		IntrusiveLinkedListHook&
+		operator = (const IntrusiveLinkedListHook&) { return *this; }
+
+	private:
+		IntrusiveLinkedListHook* next{nullptr};
+	};
+
+	/**
+	 * \brief	Intrusive singly-linked list
+	 *
+	 * The links are stored in the elements, which must inherit from
+	 * `modm::IntrusiveLinkedListHook<Tag>`. Therefore the list never allocates
+	 * memory and all operations except `getSize()` and `remove(T&)` are O(1).
+	 * The list does not own the elements, they must outlive their membership.
+	 * An element can only be in one list per hook at a time.
+	 *
+	 * The interface follows `modm::LinkedList`, but takes elements by
+	 * reference instead of copying them.
+	 *
+	 * \code
+	 * struct Message : modm::IntrusiveLinkedListHook<> { uint8_t data[8]; };
+	 * Message messages[4];
+	 * modm::IntrusiveLinkedList<Message> list;
+	 * list.append(messages[0]);
+	 * \endcode
+	 *
+	 * The list is not thread-safe, but none of the operations allocate or
+	 * block, so it can be used from interrupts within a `modm::atomic::Lock`.
+	 *
+	 * \tparam	T	type of list entries
+	 * \tparam	Tag	tag of the hook to use
+	 * \ingroup	modm_container
+	 */
+	template < typename T, typename Tag = void >
+	class IntrusiveLinkedList
+	{
+		using Hook = IntrusiveLinkedListHook<Tag>;
+
+	public:
+		template < bool Const >
+		class Iterator
+		{
+			friend class IntrusiveLinkedList;
+			friend class Iterator<not Const>;
+			using HookPtr = std::conditional_t<Const, const Hook*, Hook*>;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<Const, const T*, T*>;
+			using reference = std::conditional_t<Const, const T&, T&>;
+
+			Iterator() = default;
+			/// Converts an iterator into a const iterator
+			template < bool OtherConst > requires (Const and not OtherConst)
+			Iterator(const Iterator<OtherConst>& other) : node(other.node) {}
+
+			Iterator&
+			operator ++ ()
+			{ node = node->next; return *this; }
+
+			Iterator
+			operator ++ (int)
+			{ Iterator previous(*this); node = node->next; return previous; }
+
+			bool
+			operator == (const Iterator& other) const
+			{ return node == other.node; }
+
+			reference
+			operator * () const
+			{ return *static_cast<pointer>(node); }
+
+			pointer
+			operator -> () const
+			{ return static_cast<pointer>(node); }
+
+		private:
+			explicit Iterator(HookPtr node) : node(node) {}
+			HookPtr node{nullptr};
+		};
+
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+	public:
+		IntrusiveLinkedList()
+		{
+			static_assert(std::is_base_of_v<Hook, T>,
+					"T must inherit from modm::IntrusiveLinkedListHook<Tag>!");
+		}
+
+		IntrusiveLinkedList(const IntrusiveLinkedList&) = delete;
+		IntrusiveLinkedList&
+		operator = (const IntrusiveLinkedList&) = delete;
+
+		/// check if there are any elements in the list
+		bool
+		isEmpty() const
+		{ return front == nullptr; }
+
+		/// Number of elements, O(n)
+		std::size_t
+		getSize() const
+		{
+			std::size_t size = 0;
+			for (const Hook* node = front; node; node = node->next) size++;
+			return size;
+		}
+
+		/// Insert in front
+		void
+		prepend(T& value)
+		{
+			Hook* node = &value;
+			node->next = front;
+			front = node;
+			if (back == nullptr) back = node;
+		}
+
+		/// Insert at the end of the list
+		void
+		append(T& value)
+		{
+			Hook* node = &value;
+			node->next = nullptr;
+			if (back) back->next = node;
+			else front = node;
+			back = node;
+		}
+
+		/// Insert after the position, or at the end if position is `end()`
+		void
+		insert(const_iterator position, T& value)
+		{
+			if (position.node == nullptr) return append(value);
+			Hook* previous = const_cast<Hook*>(position.node);
+			Hook* node = &value;
+			node->next = previous->next;
+			previous->next = node;
+			if (back == previous) back = node;
+		}
+
+		/// Unlink the first element
+		void
+		removeFront()
+		{
+			Hook* node = front;
+			front = node->next;
+			if (front == nullptr) back = nullptr;
+			node->next = nullptr;
+		}
+
+		/// Unlink all elements
+		void
+		removeAll()
+		{
+			while (front) removeFront();
+		}
+
+		/// Unlinks the element, O(n).
+		/// \return `false` if the element was not in the list
+		bool
+		remove(T& value)
+		{
+			Hook* node = &value;
+			Hook* previous = nullptr;
+			for (Hook* current = front; current; previous = current, current = current->next)
+			{
+				if (current != node) continue;
+				unlink(previous, node);
+				return true;
+			}
+			return false;
+		}
+
+		/// Unlinks the element at the position, O(n).
+		/// \return iterator to the element behind the removed one
+		iterator
+		remove(const iterator& position)
+		{
+			Hook* node = position.node;
+			Hook* previous = nullptr;
+			for (Hook* current = front; current != node; current = current->next)
+			{
+				if (current == nullptr) return position;
+				previous = current;
+			}
+			Hook* next = node->next;
+			unlink(previous, node);
+			return iterator(next);
+		}
+
+		/// \return the first element in the list
+		T&
+		getFront() { return *static_cast<T*>(front); }
+
+		const T&
+		getFront() const { return *static_cast<const T*>(front); }
+
+		/// \return the last element in the list
+		T&
+		getBack() { return *static_cast<T*>(back); }
+
+		const T&
+		getBack() const { return *static_cast<const T*>(back); }
+
+		iterator
+		begin() { return iterator(front); }
+
+		const_iterator
+		begin() const { return const_iterator(front); }
+
+		iterator
+		end() { return iterator(); }
+
+		const_iterator
+		end() const { return const_iterator(); }
+
+	private:
+		void
+		unlink(Hook* previous, Hook* node)
+		{
+			if (previous) previous->next = node->next;
+			else front = node->next;
+			if (back == node) back = previous;
+			node->next = nullptr;
+		}
+
+		Hook* front{nullptr};
+		Hook* back{nullptr};
+	};
+}
+
+#endif	// MODM_INTRUSIVE_LINKED_LIST_HPP
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	MODM_INTRUSIVE_QUEUE_HPP
+#define	MODM_INTRUSIVE_QUEUE_HPP
+
+#include <type_traits>
+#include <modm/architecture/interface/atomic_lock.hpp>
+#include "intrusive_linked_list.hpp"
+
+namespace modm
+{
+	/**
+	 * \brief	Intrusive multi-producer single-consumer queue
+	 *
+	 * The links are stored in the elements, which must inherit from
+	 * `modm::IntrusiveLinkedListHook<Tag>`, so the queue never allocates memory.
+	 * Elements are pushed from any number of interrupts or threads and popped
+	 * in FIFO order by a single consumer, typically the main loop.
+	 *
+	 * \code
+	 * struct Event : modm::IntrusiveLinkedListHook<> { uint16_t id; };
+	 * modm::IntrusiveQueue<Event> events;
+	 *
+	 * MODM_ISR(EXTI0) { events.push(buttonEvent); }
+	 *
+	 * while (Event* event = events.pop()) { handle(*event); }
+	 * \endcode
+	 *
+	 * On targets with lock-free pointer atomics, `push()` is wait-free and
+	 * `pop()` does not block the producers. Otherwise both operations briefly
+	 * disable interrupts with a `modm::atomic::Lock`.
+	 *
+	 * An element must not be pushed again before it was popped. While a
+	 * producer is interrupted in the middle of `push()`, `pop()` may return
+	 * `nullptr` although the queue is not empty; the element becomes available
+	 * once the producer continues.
+	 *
+	 * \tparam	T	type of queue entries
+	 * \tparam	Tag	tag of the hook to use
+	 * \ingroup	modm_container
+	 */
+	template < typename T, typename Tag = void >
+	class IntrusiveQueue
+	{
+		using Hook = IntrusiveLinkedListHook<Tag>;
+
+	public:
+		IntrusiveQueue()
+		{
+			static_assert(std::is_base_of_v<Hook, T>,
+					"T must inherit from modm::IntrusiveLinkedListHook<Tag>!");
+		}
+
+		IntrusiveQueue(const IntrusiveQueue&) = delete;
+		IntrusiveQueue&
+		operator = (const IntrusiveQueue&) = delete;
+
+		/// \return `true` if no element is available to the consumer
+		bool
+		isEmpty() const
+		{
+			return tail == &stub and load(&stub.next) == nullptr;
+		}
+
+		/// Appends the element. May be called from any context.
+		void
+		push(T& value)
+		{
+#if __GCC_ATOMIC_POINTER_LOCK_FREE != 2
+			atomic::Lock lock;
+#endif
+			link(&value);
+		}
+
+		/// Removes the oldest element. Must only be called by a single consumer.
+		/// \return the element or `nullptr` if no element is available
+		T*
+		pop()
+		{
+#if __GCC_ATOMIC_POINTER_LOCK_FREE != 2
+			atomic::Lock lock;
+#endif
+			Hook* node = tail;
+			Hook* next = load(&node->next);
+			if (node == &stub)
+			{
+				// skip the stub, which is only used to keep the queue non-empty
+				if (next == nullptr) return nullptr;
+				tail = node = next;
+				next = load(&node->next);
+			}
+			if (next == nullptr)
+			{
+				// the last element can only be removed by re-inserting the stub
+				// behind it, unless a producer is still linking a new element
+				if (node != load(&head)) return nullptr;
+				link(&stub);
+				next = load(&node->next);
+				if (next == nullptr) return nullptr;
+			}
+			tail = next;
+			return static_cast<T*>(node);
+		}
+
+	private:
+		void
+		link(Hook* node)
+		{
+			node->next = nullptr;
+#if __GCC_ATOMIC_POINTER_LOCK_FREE == 2
+			Hook* previous = __atomic_exchange_n(&head, node, __ATOMIC_ACQ_REL);
+			__atomic_store_n(&previous->next, node, __ATOMIC_RELEASE);
+#else
+			head->next = node;
+			head = node;
+#endif
+		}
+
+		static Hook*
+		load(Hook* const* pointer)
+		{
+#if __GCC_ATOMIC_POINTER_LOCK_FREE == 2
+			return __atomic_load_n(pointer, __ATOMIC_ACQUIRE);
+#else
+			return *const_cast<Hook* const volatile*>(pointer);
+#endif
+		}
+
+		Hook stub;
+		/// last element, written by the producers
+		Hook* head{&stub};
+		/// first element, only accessed by the consumer
+		Hook* tail{&stub};
+	};
+}
+
+#endif	// MODM_INTRUSIVE_QUEUE_HPP
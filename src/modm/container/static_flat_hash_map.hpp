@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	MODM_STATIC_FLAT_HASH_MAP_HPP
+#define	MODM_STATIC_FLAT_HASH_MAP_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace modm
+{
+	/**
+	 * \brief	Default hash of `modm::StaticFlatHashMap`
+	 *
+	 * Integer and enum keys are hashed at compile time, all other
+	 * keys fall back to `std::hash`. The map scrambles the hash itself, so
+	 * the identity is good enough here.
+	 *
+	 * \ingroup	modm_container
+	 */
+	template < typename Key >
+	struct FlatHash
+	{
+		constexpr std::size_t
+		operator () (const Key& key) const
+		{
+			if constexpr (std::is_enum_v<Key>) {
+				return FlatHash<std::underlying_type_t<Key>>{}(std::underlying_type_t<Key>(key));
+			}
+			else if constexpr (std::is_integral_v<Key>)
+			{
+				if constexpr (sizeof(Key) > 4) {
+					return std::size_t(uint64_t(key) ^ (uint64_t(key) >> 32));
+				}
+				return std::size_t(key);
+			}
+			else return std::hash<Key>{}(key);
+		}
+	};
+
+	/**
+	 * \brief	Hash map with a fixed capacity
+	 *
+	 * Stores up to `N` elements in a table of `TableSize` slots without
+	 * allocating memory. The table uses open addressing with linear probing
+	 * and robin-hood insertion, so that the probe sequences stay short even
+	 * at the maximum load factor of 75%. Elements are removed by shifting the
+	 * following elements back, so there are no tombstones slowing down
+	 * lookups after many removals.
+	 *
+	 * The probe distances are stored separately from the elements, so most
+	 * unsuccessful probes only touch one cache line of distances.
+	 *
+	 * All functions are `constexpr`, so a lookup table can be built at compile
+	 * time and placed in Flash:
+	 *
+	 * \code
+	 * static constexpr modm::StaticFlatHashMap<uint16_t, const char*, 3> names{{
+	 *     {0x1234, "sensor"}, {0x2345, "motor"}, {0x3456, "display"},
+	 * }};
+	 * const char* name = *names.find(0x2345);
+	 * \endcode
+	 *
+	 * Keys and values must be default constructible.
+	 *
+	 * \tparam	Key		type of the keys
+	 * \tparam	T		type of the mapped values
+	 * \tparam	N		maximum number of elements
+	 * \tparam	Hash	hash function, must be `constexpr` for compile time maps
+	 * \tparam	KeyEqual	equality of keys
+	 *
+	 * \see		modm::StaticSortedMap
+	 * \ingroup	modm_container
+	 */
+	template < typename Key, typename T, std::size_t N,
+			   typename Hash = FlatHash<Key>, typename KeyEqual = std::equal_to<Key> >
+	class StaticFlatHashMap
+	{
+		static_assert(N > 0, "StaticFlatHashMap must hold at least one element!");
+
+	public:
+		using key_type = Key;
+		using mapped_type = T;
+		using value_type = std::pair<Key, T>;
+		using size_type = std::size_t;
+
+		/// Number of slots, at least a quarter of them are empty
+		static constexpr size_type TableSize = std::bit_ceil(N + N / 3 + 1);
+
+	private:
+		static constexpr size_type Mask = TableSize - 1;
+		static constexpr uint8_t Bits = std::countr_zero(TableSize);
+		static_assert(TableSize <= 0xffff, "StaticFlatHashMap is limited to 49151 elements!");
+		/// Probe distance + 1 of the element in the slot, zero if the slot is empty
+		using Distance = std::conditional_t< (TableSize < 0xff), uint8_t, uint16_t >;
+		static constexpr size_type Invalid = size_type(-1);
+
+	public:
+		/// Forward iterator over the elements in unspecified order
+		class const_iterator
+		{
+			friend class StaticFlatHashMap;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = StaticFlatHashMap::value_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const value_type*;
+			using reference = const value_type&;
+
+			constexpr const_iterator() = default;
+
+			constexpr const_iterator&
+			operator ++ ()
+			{
+				index = map->next(index + 1);
+				return *this;
+			}
+
+			constexpr const_iterator
+			operator ++ (int)
+			{ const_iterator previous(*this); ++*this; return previous; }
+
+			constexpr bool
+			operator == (const const_iterator& other) const
+			{ return index == other.index; }
+
+			constexpr reference
+			operator * () const
+			{ return map->slots[index]; }
+
+			constexpr pointer
+			operator -> () const
+			{ return &map->slots[index]; }
+
+		private:
+			constexpr const_iterator(const StaticFlatHashMap* map, size_type index) :
+				map(map), index(index) {}
+
+			const StaticFlatHashMap* map{nullptr};
+			size_type index{0};
+		};
+
+	public:
+		constexpr StaticFlatHashMap() = default;
+
+		/// Inserts all elements, later elements overwrite earlier ones with the same key
+		template < std::size_t M >
+		constexpr StaticFlatHashMap(const value_type (&elements)[M])
+		{
+			static_assert(M <= N, "Too many elements for the StaticFlatHashMap!");
+			for (const value_type& element : elements) insert(element.first, element.second);
+		}
+
+		constexpr bool
+		isEmpty() const
+		{ return size == 0; }
+
+		constexpr bool
+		isFull() const
+		{ return size >= N; }
+
+		constexpr size_type
+		getSize() const
+		{ return size; }
+
+		static constexpr size_type
+		getCapacity()
+		{ return N; }
+
+		/**
+		 * Inserts the element or assigns the value if the key already exists.
+		 * \return `false` if the map is full and the key is not in the map
+		 */
+		constexpr bool
+		insert(const Key& key, const T& value)
+		{
+			if (T* existing = find(key)) {
+				*existing = value;
+				return true;
+			}
+			if (isFull()) return false;
+
+			value_type element{key, value};
+			Distance distance = 1;
+			for (size_type index = home(key); ; index = (index + 1) & Mask, distance++)
+			{
+				if (distances[index] == 0)
+				{
+					slots[index] = std::move(element);
+					distances[index] = distance;
+					size++;
+					return true;
+				}
+				// take the slot from an element that is closer to its home
+				if (distances[index] < distance)
+				{
+					std::swap(slots[index], element);
+					std::swap(distances[index], distance);
+				}
+			}
+		}
+
+		/// \return `false` if the key was not in the map
+		constexpr bool
+		remove(const Key& key)
+		{
+			size_type index = locate(key);
+			if (index == Invalid) return false;
+			// shift the following elements back until one is in its home slot
+			while (true)
+			{
+				const size_type next = (index + 1) & Mask;
+				if (distances[next] <= 1) break;
+				slots[index] = std::move(slots[next]);
+				distances[index] = distances[next] - 1;
+				index = next;
+			}
+			slots[index] = value_type{};
+			distances[index] = 0;
+			size--;
+			return true;
+		}
+
+		/// Removes all elements
+		constexpr void
+		clear()
+		{
+			for (size_type index = 0; index < TableSize; ++index)
+			{
+				slots[index] = value_type{};
+				distances[index] = 0;
+			}
+			size = 0;
+		}
+
+		/// \return the value of the key or `nullptr` if the key is not in the map
+		constexpr T*
+		find(const Key& key)
+		{
+			const size_type index = locate(key);
+			return (index == Invalid) ? nullptr : &slots[index].second;
+		}
+
+		constexpr const T*
+		find(const Key& key) const
+		{
+			const size_type index = locate(key);
+			return (index == Invalid) ? nullptr : &slots[index].second;
+		}
+
+		constexpr bool
+		contains(const Key& key) const
+		{ return locate(key) != Invalid; }
+
+		constexpr const_iterator
+		begin() const
+		{ return const_iterator(this, next(0)); }
+
+		constexpr const_iterator
+		end() const
+		{ return const_iterator(this, TableSize); }
+
+	private:
+		/// Fibonacci hashing of the key to the slot index
+		static constexpr size_type
+		home(const Key& key)
+		{
+			return uint32_t(uint32_t(Hash{}(key)) * 0x9e3779b9ul) >> (32 - Bits);
+		}
+
+		constexpr size_type
+		locate(const Key& key) const
+		{
+			Distance distance = 1;
+			for (size_type index = home(key); ; index = (index + 1) & Mask, distance++)
+			{
+				// the key would have displaced an element closer to its home
+				if (distances[index] < distance) return Invalid;
+				if (distances[index] == distance and KeyEqual{}(slots[index].first, key))
+					return index;
+			}
+		}
+
+		constexpr size_type
+		next(size_type index) const
+		{
+			while (index < TableSize and distances[index] == 0) index++;
+			return index;
+		}
+
+		value_type slots[TableSize]{};
+		Distance distances[TableSize]{};
+		size_type size{0};
+	};
+}
+
+#endif	// MODM_STATIC_FLAT_HASH_MAP_HPP
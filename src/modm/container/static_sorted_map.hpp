@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	MODM_STATIC_SORTED_MAP_HPP
+#define	MODM_STATIC_SORTED_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace modm
+{
+	/**
+	 * \brief	Sorted map with a fixed capacity
+	 *
+	 * Stores up to `N` elements sorted by key in a contiguous array without
+	 * allocating memory. Lookups are binary searches, insertion and removal
+	 * move the following elements, so the map is best suited for tables that
+	 * are mostly read. Iteration is in ascending key order.
+	 *
+	 * All functions are `constexpr`, so a lookup table can be built at compile
+	 * time and placed in Flash. The elements do not need to be given in order:
+	 *
+	 * \code
+	 * static constexpr modm::StaticSortedMap<uint8_t, uint16_t, 3> divider{{
+	 *     {48, 1}, {8, 6}, {16, 3},
+	 * }};
+	 * uint16_t value = *divider.find(16);
+	 * \endcode
+	 *
+	 * Keys and values must be default constructible.
+	 *
+	 * \tparam	Key		type of the keys
+	 * \tparam	T		type of the mapped values
+	 * \tparam	N		maximum number of elements
+	 * \tparam	Compare	strict weak ordering of the keys
+	 *
+	 * \see		modm::StaticFlatHashMap
+	 * \ingroup	modm_container
+	 */
+	template < typename Key, typename T, std::size_t N, typename Compare = std::less<Key> >
+	class StaticSortedMap
+	{
+		static_assert(N > 0, "StaticSortedMap must hold at least one element!");
+
+	public:
+		using key_type = Key;
+		using mapped_type = T;
+		using value_type = std::pair<Key, T>;
+		using size_type = std::size_t;
+		using const_iterator = const value_type*;
+
+	public:
+		constexpr StaticSortedMap() = default;
+
+		/// Inserts all elements, later elements overwrite earlier ones with the same key
+		template < std::size_t M >
+		constexpr StaticSortedMap(const value_type (&elements)[M])
+		{
+			static_assert(M <= N, "Too many elements for the StaticSortedMap!");
+			for (const value_type& element : elements) insert(element.first, element.second);
+		}
+
+		constexpr bool
+		isEmpty() const
+		{ return size == 0; }
+
+		constexpr bool
+		isFull() const
+		{ return size >= N; }
+
+		constexpr size_type
+		getSize() const
+		{ return size; }
+
+		static constexpr size_type
+		getCapacity()
+		{ return N; }
+
+		/**
+		 * Inserts the element or assigns the value if the key already exists.
+		 * \return `false` if the map is full and the key is not in the map
+		 */
+		constexpr bool
+		insert(const Key& key, const T& value)
+		{
+			value_type* position = insertPosition(key);
+			if (position != elements + size and not Compare{}(key, position->first))
+			{
+				position->second = value;
+				return true;
+			}
+			if (isFull()) return false;
+			std::move_backward(position, elements + size, elements + size + 1);
+			*position = value_type{key, value};
+			size++;
+			return true;
+		}
+
+		/// \return `false` if the key was not in the map
+		constexpr bool
+		remove(const Key& key)
+		{
+			value_type* position = const_cast<value_type*>(locate(key));
+			if (position == nullptr) return false;
+			std::move(position + 1, elements + size, position);
+			elements[--size] = value_type{};
+			return true;
+		}
+
+		/// Removes all elements
+		constexpr void
+		clear()
+		{
+			for (size_type index = 0; index < size; ++index) elements[index] = value_type{};
+			size = 0;
+		}
+
+		/// \return the value of the key or `nullptr` if the key is not in the map
+		constexpr T*
+		find(const Key& key)
+		{
+			const value_type* position = locate(key);
+			return position ? &const_cast<value_type*>(position)->second : nullptr;
+		}
+
+		constexpr const T*
+		find(const Key& key) const
+		{
+			const value_type* position = locate(key);
+			return position ? &position->second : nullptr;
+		}
+
+		constexpr bool
+		contains(const Key& key) const
+		{ return locate(key) != nullptr; }
+
+		/// \return the first element with a key not less than the key
+		constexpr const_iterator
+		lowerBound(const Key& key) const
+		{
+			return std::lower_bound(begin(), end(), key,
+					[](const value_type& element, const Key& key)
+					{ return Compare{}(element.first, key); });
+		}
+
+		/// \return the first element with a key greater than the key
+		constexpr const_iterator
+		upperBound(const Key& key) const
+		{
+			return std::upper_bound(begin(), end(), key,
+					[](const Key& key, const value_type& element)
+					{ return Compare{}(key, element.first); });
+		}
+
+		constexpr const_iterator
+		begin() const
+		{ return elements; }
+
+		constexpr const_iterator
+		end() const
+		{ return elements + size; }
+
+	private:
+		constexpr value_type*
+		insertPosition(const Key& key)
+		{
+			return const_cast<value_type*>(std::as_const(*this).lowerBound(key));
+		}
+
+		constexpr const value_type*
+		locate(const Key& key) const
+		{
+			const value_type* position = lowerBound(key);
+			if (position == end() or Compare{}(key, position->first)) return nullptr;
+			return position;
+		}
+
+		value_type elements[N]{};
+		size_type size{0};
+	};
+}
+
+#endif	// MODM_STATIC_SORTED_MAP_HPP
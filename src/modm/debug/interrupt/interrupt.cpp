@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "interrupt.hpp"
+#include <modm/architecture/interface/atomic_lock.hpp>
+#include <modm/platform/core/hardware_init.hpp>
+
+static modm::interrupt::Statistics interruptStatistics;
+
+// Called by the vector table wrappers before and after every handler
+extern "C" void
+modm_interrupt_enter()
+{
+	modm::atomic::Lock lock;
+	interruptStatistics.enter(__get_IPSR() & 0x1ff, DWT->CYCCNT);
+}
+
+extern "C" void
+modm_interrupt_exit()
+{
+	modm::atomic::Lock lock;
+	interruptStatistics.exit(DWT->CYCCNT);
+}
+
+static void
+modm_interrupt_dwt_enable()
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+MODM_HARDWARE_INIT(modm_interrupt_dwt_enable);
+
+namespace modm::interrupt
+{
+
+const Statistics&
+statistics()
+{
+	return interruptStatistics;
+}
+
+Statistics::Entry
+get(size_t index)
+{
+	atomic::Lock lock;
+	return interruptStatistics[index];
+}
+
+uint64_t
+getBusyCycles()
+{
+	atomic::Lock lock;
+	return interruptStatistics.getBusyCycles();
+}
+
+void
+reset()
+{
+	atomic::Lock lock;
+	interruptStatistics.reset();
+}
+
+}	// namespace modm::interrupt
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "statistics.hpp"
+#include <modm/platform/core/vectors.hpp>
+#include <modm/platform/device.hpp>
+#include <iterator>
+
+namespace modm::interrupt
+{
+
+/// Statistics of all exceptions indexed by their exception number (IRQn + 16).
+/// @ingroup modm_debug_interrupt
+using Statistics = InterruptStatistics<
+		std::size(modm::platform::detail::vectorNames),
+		((1u << __NVIC_PRIO_BITS) < 16u) ? (1u << __NVIC_PRIO_BITS) : 16u>;
+
+/// Direct access to the statistics, which are updated by interrupts.
+/// @ingroup modm_debug_interrupt
+const Statistics&
+statistics();
+
+/// @returns a consistent copy of the statistics of one exception.
+/// @ingroup modm_debug_interrupt
+Statistics::Entry
+get(size_t index);
+
+/// @returns the total cycles spent in interrupts since the last reset.
+/// @ingroup modm_debug_interrupt
+uint64_t
+getBusyCycles();
+
+/// Clears all statistics.
+/// @ingroup modm_debug_interrupt
+void
+reset();
+
+/// @returns the number of exceptions.
+/// @ingroup modm_debug_interrupt
+constexpr size_t
+size()
+{ return Statistics::size(); }
+
+/// @returns the name of the exception, for example "SysTick" or "USART1".
+/// @ingroup modm_debug_interrupt
+constexpr std::string_view
+name(size_t index)
+{ return modm::platform::detail::vectorNames[index]; }
+
+/// @returns the current value of the DWT cycle counter.
+/// @ingroup modm_debug_interrupt
+inline uint32_t
+now()
+{ return DWT->CYCCNT; }
+
+}	// namespace modm::interrupt
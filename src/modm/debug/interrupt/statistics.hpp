@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace modm
+{
+
+/**
+ * Aggregates the execution time of nested interrupts.
+ *
+ * `enter()` and `exit()` must be called in pairs at the beginning and end of
+ * every interrupt handler with a monotonic timestamp, for example the DWT cycle
+ * counter. The duration of an interrupt excludes the time spent in interrupts
+ * that preempted it, so that the sum of all durations is the total time spent
+ * in interrupts.
+ *
+ * The calls are not reentrant: they must be made with interrupts disabled.
+ * Timestamps are compared with wrap-around arithmetic, therefore a single
+ * interrupt must not run longer than the timestamp range.
+ *
+ * @tparam	Count		number of interrupts, `enter()` takes an index below it.
+ * @tparam	MaxDepth	maximum nesting depth that is tracked, deeper nested
+ *						interrupts are only counted in `getOverflows()`.
+ *
+ * @ingroup	modm_debug_interrupt
+ */
+template< size_t Count, size_t MaxDepth = 8 >
+class InterruptStatistics
+{
+	static_assert(Count > 0 and Count <= 0xffff);
+	static_assert(MaxDepth > 0 and MaxDepth < 0xff);
+
+public:
+	/// Statistics of a single interrupt
+	struct Entry
+	{
+		uint32_t count;			///< number of executions
+		uint32_t nested;		///< number of times it preempted another interrupt
+		uint32_t maxCycles;		///< longest execution time
+		uint64_t totalCycles;	///< sum of all execution times
+		uint8_t maxDepth;		///< deepest nesting level, one if never nested
+
+		uint32_t
+		averageCycles() const
+		{ return count ? totalCycles / count : 0; }
+	};
+
+public:
+	void
+	enter(size_t index, uint32_t timestamp)
+	{
+		if (depth >= MaxDepth)
+		{
+			depth++;
+			overflows++;
+			return;
+		}
+		if (depth)
+		{
+			// pause the preempted interrupt
+			Frame& top = frames[depth - 1];
+			top.cycles += timestamp - top.resumed;
+		}
+		frames[depth] = {uint16_t(index), timestamp, 0};
+		depth++;
+		if (depth > maxDepth) maxDepth = depth;
+	}
+
+	void
+	exit(uint32_t timestamp)
+	{
+		if (depth == 0) return;
+		if (--depth >= MaxDepth) return;
+
+		const Frame& frame = frames[depth];
+		const uint32_t cycles = frame.cycles + (timestamp - frame.resumed);
+		Entry& entry = entries[frame.index];
+		entry.count++;
+		entry.totalCycles += cycles;
+		if (cycles > entry.maxCycles) entry.maxCycles = cycles;
+		if (depth >= entry.maxDepth) entry.maxDepth = depth + 1;
+		if (depth) entry.nested++;
+		busyCycles += cycles;
+
+		// resume the preempted interrupt
+		if (depth) frames[depth - 1].resumed = timestamp;
+	}
+
+	/// Clears the statistics, but keeps tracking the currently active interrupts.
+	void
+	reset()
+	{
+		for (Entry& entry : entries) entry = {};
+		busyCycles = 0;
+		overflows = 0;
+		maxDepth = depth;
+	}
+
+	const Entry&
+	operator[](size_t index) const
+	{ return entries[index]; }
+
+	static constexpr size_t
+	size()
+	{ return Count; }
+
+	/// @returns the sum of all interrupt execution times.
+	uint64_t
+	getBusyCycles() const
+	{ return busyCycles; }
+
+	/// @returns the deepest nesting level of any interrupt.
+	uint8_t
+	getMaxDepth() const
+	{ return maxDepth; }
+
+	/// @returns the number of interrupts nested deeper than `MaxDepth`.
+	uint32_t
+	getOverflows() const
+	{ return overflows; }
+
+	/// @returns the current nesting level, zero outside of interrupts.
+	uint8_t
+	getDepth() const
+	{ return depth; }
+
+private:
+	struct Frame
+	{
+		uint16_t index;
+		uint32_t resumed;	///< timestamp of the last entry or resumption
+		uint32_t cycles;	///< execution time until the last preemption
+	};
+
+	Entry entries[Count]{};
+	Frame frames[MaxDepth]{};
+	uint64_t busyCycles{0};
+	uint32_t overflows{0};
+	uint8_t depth{0};
+	uint8_t maxDepth{0};
+};
+
+}	// namespace modm
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2016, 2018, Niklas Hauser
+ * Copyright (c) 2015-2016, 2018, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -245,6 +245,14 @@ public:
 	template < Mcp23x17<Transport> &object, Pin StartPin, uint8_t Width, GpioPort::DataOrder DataOrder = GpioPort::DataOrder::Normal  >
 	using Port = GpioExpanderPort< Mcp23x17<Transport>, object, StartPin, Width, DataOrder >;
 
+	/// Alias-templates for coalesced access via shadow registers
+	/// @{
+	template < Mcp23x17<Transport> &object >
+	using Shadow = GpioExpanderShadow< Mcp23x17<Transport>, object >;
+	template < Mcp23x17<Transport> &object, Pin pin >
+	using ShadowPin = GpioExpanderShadowPin< Mcp23x17<Transport>, object, pin >;
+	/// @}
+
 private:
 	struct modm_packed
 	Memory
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2018, Niklas Hauser
+ * Copyright (c) 2015, 2018, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -178,7 +178,7 @@ modm::Mcp23x17<Transport>::writePort(uint16_t data)
 	// output is 0, input is 1
 	// set output latches locally, but only those that are output
 	// clear all outputs
-	memory.outputLatch.clear(~memory.direction);
+	memory.outputLatch.reset(~memory.direction);
 	// set masked output values
 	memory.outputLatch.set(Pins(data) & ~memory.direction);
 
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2015, Sascha Schade
- * Copyright (c) 2015, 2017-2018, Niklas Hauser
+ * Copyright (c) 2015, 2017-2018, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -166,6 +166,14 @@ public:
 	template < Pca8574<I2cMaster> &object, Pin StartPin, uint8_t Width, GpioPort::DataOrder DataOrder = GpioPort::DataOrder::Normal >
 	using Port = GpioExpanderPort< Pca8574<I2cMaster>, object, StartPin, Width, DataOrder >;
 
+	/// Alias-templates for coalesced access via shadow registers
+	/// @{
+	template < Pca8574<I2cMaster> &object >
+	using Shadow = GpioExpanderShadow< Pca8574<I2cMaster>, object >;
+	template < Pca8574<I2cMaster> &object, Pin pin >
+	using ShadowPin = GpioExpanderShadowPin< Pca8574<I2cMaster>, object, pin >;
+	/// @}
+
 private:
 	// buffer the io states
 	Pins direction; // output = 1, input = 0
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2016, 2018, Niklas Hauser
+ * Copyright (c) 2015-2016, 2018, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -217,6 +217,14 @@ public:
 	template < Pca9535<I2cMaster> &object, Pin StartPin, uint8_t Width, GpioPort::DataOrder DataOrder = GpioPort::DataOrder::Normal  >
 	using Port = GpioExpanderPort< Pca9535<I2cMaster>, object, StartPin, Width, DataOrder >;
 
+	/// Alias-templates for coalesced access via shadow registers
+	/// @{
+	template < Pca9535<I2cMaster> &object >
+	using Shadow = GpioExpanderShadow< Pca9535<I2cMaster>, object >;
+	template < Pca9535<I2cMaster> &object, Pin pin >
+	using ShadowPin = GpioExpanderShadowPin< Pca9535<I2cMaster>, object, pin >;
+	/// @}
+
 private:
 	modm::ResumableResult<bool>
 	writeMemory(Index index);
@@ -92,6 +92,8 @@ protected:
 
 private:
     uint8_t whoAmI;
+    uint8_t command[2];
+    modm::Spi::Segment segments[2];
 
     // write read bit on the address
     static constexpr uint8_t Read = Bit7;
@@ -93,14 +93,10 @@ modm::Ixm42xxxTransportSpi<SpiMaster, Cs>::write(uint8_t reg, uint8_t value)
 {
     RF_BEGIN();
 
-    RF_WAIT_UNTIL(this->acquireMaster());
-    Cs::reset();
-
-    RF_CALL(SpiMaster::transfer(reg | Write));
-    RF_CALL(SpiMaster::transfer(value));
-
-    if (this->releaseMaster())
-        Cs::set();
+    command[0] = reg | Write;
+    command[1] = value;
+    segments[0] = {command, nullptr, 2};
+    RF_CALL(this->template runTransaction<Cs>({segments, 1}));
 
     RF_END_RETURN(true);
 }
@@ -122,14 +118,11 @@ modm::Ixm42xxxTransportSpi<SpiMaster, Cs>::read(uint8_t reg, uint8_t *buffer, st
 {
     RF_BEGIN();
 
-    RF_WAIT_UNTIL(this->acquireMaster());
-    Cs::reset();
-
-    RF_CALL(SpiMaster::transfer(reg | Read));
-    RF_CALL(SpiMaster::transfer(nullptr, buffer, length));
-
-    if (this->releaseMaster())
-        Cs::set();
+    // address and data phase in one transaction
+    command[0] = reg | Read;
+    segments[0] = {command, nullptr, 1};
+    segments[1] = {nullptr, buffer, length};
+    RF_CALL(this->template runTransaction<Cs>(segments));
 
     RF_END_RETURN(true);
 }
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2009-2011, Fabian Greif
- * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2012, 2026, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
  *
  * This file is part of the modm project.
@@ -56,6 +56,9 @@ namespace modm
 		inline SizeType
 		getNumberOfPoints() const;
 
+		/// Allocate storage for at least n more points
+		inline void
+		reserve(SizeType n);
 
 		inline void
 		append(const PointType& point);
@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2011, Fabian Greif
- * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2012, 2026, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
  *
  * This file is part of the modm project.
@@ -51,6 +51,13 @@ modm::PointSet2D<T>::getNumberOfPoints() const
 	return points.getSize();
 }
 
+template <typename T>
+void
+modm::PointSet2D<T>::reserve(SizeType n)
+{
+	points.reserve(n);
+}
+
 // ----------------------------------------------------------------------------
 template <typename T>
 void
@@ -21,15 +21,58 @@
 #include <sys/ioctl.h>
 #include <net/if.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
 
 #include <linux/can.h>
 #include <linux/can/raw.h>
 #include <string.h>
+#include <algorithm>
+#include <vector>
 
 #undef  MODM_LOG_LEVEL
 #define MODM_LOG_LEVEL modm::log::DEBUG
 
+static constexpr bool
+flexibleDataEnabled = (modm::can::Message::capacity > 8);
+
+static void
+toMessage(const struct canfd_frame& frame, int nbytes, modm::can::Message& message)
+{
+	const bool extended = frame.can_id & CAN_EFF_FLAG;
+	message.identifier = frame.can_id & (extended ? CAN_EFF_MASK : CAN_SFF_MASK);
+	message.setExtended(extended);
+	message.setRemoteTransmitRequest(frame.can_id & CAN_RTR_FLAG);
+	message.setFlexibleData(false);
+	message.flags.brs = false;
+	message.setLength(frame.len);
+	if (nbytes == CANFD_MTU)
+	{
+		message.setFlexibleData();
+		message.flags.brs = (frame.flags & CANFD_BRS);
+	}
+	std::copy_n(frame.data, message.getLength(), message.data);
+}
+
+/// @return the number of bytes to transfer
+static std::size_t
+toFrame(const modm::can::Message& message, struct canfd_frame& frame)
+{
+	frame.can_id = message.identifier;
+	if (message.isExtended()) {
+		frame.can_id |= CAN_EFF_FLAG;
+	}
+	if (message.isRemoteTransmitRequest()) {
+		frame.can_id |= CAN_RTR_FLAG;
+	}
+	frame.len = message.getLength();
+	frame.flags = message.isBitRateSwitching() ? CANFD_BRS : 0;
+	frame.__res0 = frame.__res1 = 0;
+	std::copy_n(message.data, message.getLength(), frame.data);
+
+	return (flexibleDataEnabled and message.isFlexibleData()) ? CANFD_MTU : CAN_MTU;
+}
+
 modm::platform::SocketCan::~SocketCan()
 {
 	close();
@@ -77,7 +120,24 @@ modm::platform::SocketCan::open(std::string deviceName)
 		return false;
 	}
 
+	if constexpr (flexibleDataEnabled)
+	{
+		const int enable = 1;
+		if (setsockopt(skt, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &enable, sizeof(enable)) < 0) {
+			MODM_LOG_ERROR << MODM_FILE_INFO;
+			MODM_LOG_ERROR << "Could not enable CAN-FD frames: " << strerror(errno) << modm::endl;
+		}
+	}
+
+	// Kernel receive timestamps are delivered as control messages
+	const int enable = 1;
+	if (setsockopt(skt, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) < 0) {
+		MODM_LOG_ERROR << MODM_FILE_INFO;
+		MODM_LOG_ERROR << "Could not enable receive timestamps: " << strerror(errno) << modm::endl;
+	}
+
 	fcntl(skt, F_SETFL, O_NONBLOCK);
+	rxIndex = rxCount = 0;
 
 	MODM_LOG_DEBUG << MODM_FILE_INFO;
 	MODM_LOG_DEBUG << "SocketCAN opened successfully with skt = " << skt << modm::endl;
@@ -101,61 +161,145 @@ modm::platform::SocketCan::getBusState()
 }
 
 bool
-modm::platform::SocketCan::isMessageAvailable()
+modm::platform::SocketCan::receive()
 {
-	struct can_frame frame;
-	int nbytes = recv(skt, &frame, sizeof(struct can_frame), MSG_DONTWAIT | MSG_PEEK);
+	struct canfd_frame frames[BatchSize];
+	struct iovec iovs[BatchSize];
+	struct mmsghdr msgs[BatchSize]{};
+	char controls[BatchSize][CMSG_SPACE(sizeof(struct timespec))];
 
-	// recv returns 'Resource temporary not available' which is wired but ignored here.
-	/* if (nbytes < 0)
+	for (std::size_t ii = 0; ii < BatchSize; ++ii)
 	{
-		MODM_LOG_DEBUG << MODM_FILE_INFO;
-		MODM_LOG_DEBUG << strerror(errno) << modm::endl;
-	} */
+		iovs[ii].iov_base = &frames[ii];
+		iovs[ii].iov_len = sizeof(struct canfd_frame);
+		msgs[ii].msg_hdr.msg_iov = &iovs[ii];
+		msgs[ii].msg_hdr.msg_iovlen = 1;
+		msgs[ii].msg_hdr.msg_control = controls[ii];
+		msgs[ii].msg_hdr.msg_controllen = sizeof(controls[ii]);
+	}
+
+	const int count = recvmmsg(skt, msgs, BatchSize, MSG_DONTWAIT, nullptr);
+	// recvmmsg returns 'Resource temporary not available' if no frame is queued.
+	if (count <= 0) return false;
+
+	rxIndex = rxCount = 0;
+	for (int ii = 0; ii < count; ++ii)
+	{
+		const int nbytes = msgs[ii].msg_len;
+		if (nbytes != CAN_MTU and nbytes != CANFD_MTU) continue;
+
+		toMessage(frames[ii], nbytes, rxMessages[rxCount]);
+
+		Timestamp timestamp{};
+		for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msgs[ii].msg_hdr);
+			 cmsg != nullptr; cmsg = CMSG_NXTHDR(&msgs[ii].msg_hdr, cmsg))
+		{
+			if (cmsg->cmsg_level == SOL_SOCKET and cmsg->cmsg_type == SCM_TIMESTAMPNS)
+			{
+				struct timespec ts;
+				memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+				timestamp = Timestamp(std::chrono::duration_cast<Timestamp::duration>(
+						std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec)));
+			}
+		}
+		rxTimestamps[rxCount++] = timestamp;
+	}
+	return rxCount > 0;
+}
 
-	return (nbytes > 0);
+bool
+modm::platform::SocketCan::isMessageAvailable()
+{
+	return (rxIndex < rxCount) or receive();
 }
 
 bool
-modm::platform::SocketCan::getMessage(can::Message& message)
+modm::platform::SocketCan::getMessage(can::Message& message, Timestamp *timestamp)
 {
-	struct can_frame frame;
-	int nbytes = recv(skt, &frame, sizeof(struct can_frame), MSG_DONTWAIT);
+	if (not isMessageAvailable()) return false;
+
+	message = rxMessages[rxIndex];
+	if (timestamp) *timestamp = rxTimestamps[rxIndex];
+	rxIndex++;
+	return true;
+}
 
-	if (nbytes > 0)
+std::size_t
+modm::platform::SocketCan::getMessages(std::span<can::Message> messages, Timestamp *timestamps)
+{
+	std::size_t count = 0;
+	while (count < messages.size() and isMessageAvailable())
 	{
-		message.identifier = frame.can_id;
-		message.setDataLengthCode(frame.can_dlc);
-		message.setExtended(frame.can_id & CAN_EFF_FLAG);
-		message.setRemoteTransmitRequest(frame.can_id & CAN_RTR_FLAG);
-		for (uint8_t ii = 0; ii < frame.can_dlc; ++ii) {
-			message.data[ii] = frame.data[ii];
+		const std::size_t chunk = std::min(messages.size() - count, rxCount - rxIndex);
+		std::copy_n(&rxMessages[rxIndex], chunk, &messages[count]);
+		if (timestamps) {
+			std::copy_n(&rxTimestamps[rxIndex], chunk, &timestamps[count]);
 		}
-		return true;
+		rxIndex += chunk;
+		count += chunk;
 	}
-	return false;
+	return count;
 }
 
 bool
 modm::platform::SocketCan::sendMessage(const can::Message& message)
 {
-	struct can_frame frame;
+	struct canfd_frame frame;
+	const std::size_t size = toFrame(message, frame);
 
-	frame.can_id = message.identifier;
-	if (message.isExtended()) {
-		frame.can_id |= CAN_EFF_FLAG;
-	}
-	if (message.isRemoteTransmitRequest()) {
-		frame.can_id |= CAN_RTR_FLAG;
-	}
+	int bytes_sent = write( skt, &frame, size );
+
+	return (bytes_sent > 0);
+}
 
-	frame.can_dlc = message.getLength();
+std::size_t
+modm::platform::SocketCan::sendMessages(std::span<const can::Message> messages)
+{
+	struct canfd_frame frames[BatchSize];
+	struct iovec iovs[BatchSize];
+	struct mmsghdr msgs[BatchSize]{};
+
+	std::size_t sent = 0;
+	while (sent < messages.size())
+	{
+		const std::size_t chunk = std::min(messages.size() - sent, BatchSize);
+		for (std::size_t ii = 0; ii < chunk; ++ii)
+		{
+			iovs[ii].iov_base = &frames[ii];
+			iovs[ii].iov_len = toFrame(messages[sent + ii], frames[ii]);
+			msgs[ii].msg_hdr.msg_iov = &iovs[ii];
+			msgs[ii].msg_hdr.msg_iovlen = 1;
+		}
 
-	for (uint8_t ii = 0; ii < message.getLength(); ++ii) {
-		frame.data[ii] = message.data[ii];
+		const int count = sendmmsg(skt, msgs, chunk, MSG_DONTWAIT);
+		if (count <= 0) break;
+		sent += count;
+		// the kernel transmit queue is full
+		if (std::size_t(count) < chunk) break;
 	}
+	return sent;
+}
 
-	int bytes_sent = write( skt, &frame, sizeof(frame) );
+std::size_t
+modm::platform::SocketCan::wait(std::span<SocketCan* const> interfaces,
+								std::chrono::milliseconds timeout)
+{
+	std::size_t ready = 0;
+	std::vector<struct pollfd> fds;
+	fds.reserve(interfaces.size());
+	for (SocketCan *interface : interfaces)
+	{
+		// frames already buffered do not need to wait for the socket
+		if (interface->rxIndex < interface->rxCount) ready++;
+		fds.push_back({interface->skt, POLLIN, 0});
+	}
+	if (ready) return ready;
 
-	return (bytes_sent > 0);
+	if (poll(fds.data(), fds.size(), timeout.count() < 0 ? -1 : int(timeout.count())) <= 0)
+		return 0;
+
+	for (const struct pollfd& fd : fds) {
+		if (fd.revents & POLLIN) ready++;
+	}
+	return ready;
 }
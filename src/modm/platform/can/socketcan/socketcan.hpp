@@ -13,7 +13,10 @@
 #ifndef MODM_HOSTED_SOCKETCAN_HPP
 #define MODM_HOSTED_SOCKETCAN_HPP
 
+#include <array>
+#include <chrono>
 #include <iostream>
+#include <span>
 
 #include <modm/architecture/interface/can.hpp>
 
@@ -23,9 +26,32 @@ namespace modm
 namespace platform
 {
 
-/// @ingroup modm_platform_socketcan
+/**
+ * CAN interface using the Linux SocketCAN raw socket.
+ *
+ * Frames are received in batches of up to `BatchSize` frames with a single
+ * `recvmmsg()` system call and buffered internally, `sendMessages()` uses
+ * `sendmmsg()` in the same way. Each received frame carries the kernel
+ * receive timestamp, which can be retrieved with `getMessage()`.
+ *
+ * CAN-FD frames are supported if the `modm:architecture:can:message.buffer`
+ * option is larger than 8 bytes.
+ *
+ * Multiple interfaces can be served in one event loop by waiting on all of
+ * them with `wait()` or by adding `getFileDescriptor()` to an existing
+ * `poll()`/`epoll()` loop.
+ *
+ * @ingroup modm_platform_socketcan
+ */
 class SocketCan : public ::modm::Can
 {
+public:
+	/// Maximum number of frames transferred per system call
+	static constexpr std::size_t BatchSize = 32;
+
+	/// Kernel receive timestamp in system time
+	using Timestamp = std::chrono::system_clock::time_point;
+
 public:
 	SocketCan() = default;
 
@@ -41,7 +67,14 @@ public:
 	isMessageAvailable();
 
 	bool
-	getMessage(can::Message& message);
+	getMessage(can::Message& message, Timestamp *timestamp = nullptr);
+
+	/**
+	 * @param timestamps	optional array of at least `messages.size()` elements
+	 * @return number of messages copied into the span
+	 */
+	std::size_t
+	getMessages(std::span<can::Message> messages, Timestamp *timestamps = nullptr);
 
 	inline bool
 	isReadyToSend() { return true; }
@@ -52,8 +85,36 @@ public:
 	bool
 	sendMessage(const can::Message& message);
 
+	/// @return number of messages sent, stops when the kernel queue is full
+	std::size_t
+	sendMessages(std::span<const can::Message> messages);
+
+	/// The socket file descriptor for use in an external event loop
+	int
+	getFileDescriptor() const
+	{ return skt; }
+
+	/**
+	 * Waits until at least one of the interfaces has received a message.
+	 *
+	 * @param timeout	maximum time to wait, negative values wait forever.
+	 * @return number of interfaces with available messages.
+	 */
+	static std::size_t
+	wait(std::span<SocketCan* const> interfaces,
+		 std::chrono::milliseconds timeout = std::chrono::milliseconds(-1));
+
 private:
+	/// Refills the receive buffer with one `recvmmsg()` call.
+	bool
+	receive();
+
 	int skt{-1};
+
+	std::array<can::Message, BatchSize> rxMessages;
+	std::array<Timestamp, BatchSize> rxTimestamps;
+	std::size_t rxIndex{0};
+	std::size_t rxCount{0};
 };
 
 } // namespace platform
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include "virtual_time.hpp"
+
+using VirtualTime = modm::platform::VirtualTime;
+
+static VirtualTime::duration currentTime{0};
+static VirtualTime::duration nextWakeup{VirtualTime::duration::max()};
+static bool idle{false};
+
+VirtualTime::duration
+VirtualTime::now()
+{
+	return currentTime;
+}
+
+void
+VirtualTime::advance(duration interval)
+{
+	currentTime += interval;
+}
+
+bool
+VirtualTime::advanceToWakeup()
+{
+	if (nextWakeup == duration::max()) return false;
+	if (nextWakeup > currentTime) currentTime = nextWakeup;
+	nextWakeup = duration::max();
+	return true;
+}
+
+VirtualTime::duration
+VirtualTime::getNextWakeup()
+{
+	return nextWakeup;
+}
+
+void
+VirtualTime::wakeupAt(duration wakeup)
+{
+	if (wakeup < nextWakeup) nextWakeup = wakeup;
+	idle = true;
+}
+
+bool
+VirtualTime::takeIdle()
+{
+	const bool wasIdle = idle;
+	idle = false;
+	return wasIdle;
+}
+
+// ----------------------------------------------------------------------------
+modm::chrono::milli_clock::time_point modm_weak
+modm::chrono::milli_clock::now() noexcept
+{
+	return time_point{std::chrono::duration_cast<duration>(currentTime)};
+}
+
+modm::chrono::micro_clock::time_point modm_weak
+modm::chrono::micro_clock::now() noexcept
+{
+	return time_point{std::chrono::duration_cast<duration>(currentTime)};
+}
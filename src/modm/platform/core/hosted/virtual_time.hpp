@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+/// Defined if the `modm:platform:core:virtual_time` option is enabled.
+/// @ingroup modm_platform_core
+#define MODM_HAS_VIRTUAL_TIME 1
+
+namespace modm::platform
+{
+
+/**
+ * Deterministic virtual time for hosted targets.
+ *
+ * `modm::chrono::milli_clock` and `modm::chrono::micro_clock` return the
+ * virtual time, which starts at zero and only moves forward when advanced.
+ * Every `modm::Timeout` or `modm::PeriodicTimer` that is checked before it
+ * expired registers its expiration time as a pending wakeup. The fiber
+ * scheduler advances the time directly to the earliest pending wakeup as soon
+ * as all fibers are idle, so that long running tests finish in milliseconds.
+ * `modm::delay()` advances the time by the delay.
+ *
+ * A fiber is considered idle when it checked an unexpired timeout before it
+ * yielded, which is the case for `modm::fiber::sleep()`. If you poll timers
+ * from a main loop instead, call `advanceToWakeup()` at the end of every loop
+ * iteration, after all timers have been checked.
+ *
+ * @ingroup modm_platform_core
+ */
+class VirtualTime
+{
+public:
+	using duration = std::chrono::nanoseconds;
+
+	/// @returns the virtual time since start.
+	static duration
+	now();
+
+	/// Advances the virtual time by the interval.
+	static void
+	advance(duration interval);
+
+	/**
+	 * Advances the virtual time to the earliest pending wakeup and clears all
+	 * pending wakeups.
+	 *
+	 * @returns `false` if no wakeup was pending.
+	 */
+	static bool
+	advanceToWakeup();
+
+	/// @returns the earliest pending wakeup or `duration::max()` if there is none.
+	static duration
+	getNextWakeup();
+
+	/**
+	 * Registers a pending wakeup after the remaining time of a timer.
+	 * The remaining time is counted from the last tick of the timer's clock,
+	 * so that the timer is expired exactly at the wakeup.
+	 */
+	template< class Rep, class Period >
+	static void
+	wakeup(std::chrono::duration<Rep, Period> remaining)
+	{
+		using Tick = std::chrono::duration<Rep, Period>;
+		const auto tick = std::chrono::duration_cast<duration>(Tick(1)).count();
+		const auto last = (now().count() / tick) * tick;
+		wakeupAt(duration(last) + std::chrono::duration_cast<duration>(remaining));
+	}
+
+	/// Registers a pending wakeup at an absolute virtual time.
+	static void
+	wakeupAt(duration time);
+
+	/// @cond
+	/// @returns if a wakeup was registered since the last call.
+	static bool
+	takeIdle();
+	/// @endcond
+};
+
+} // namespace modm::platform
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace modm::platform
+{
+
+/// @cond
+namespace detail
+{
+
+/**
+ * Compile-time mapping between the bits of a software port and the pins of
+ * one hardware port.
+ *
+ * All bits that move by the same distance between the data word and the
+ * port register are grouped together and moved with a single shift and mask.
+ * Consecutive pins that are connected to consecutive port bits therefore
+ * cost one shift and mask in total instead of one per pin.
+ *
+ * @tparam Pins	port pin of each data bit ordered MSB to LSB,
+ *				or -1 if the bit is not connected to this port.
+ */
+template< int8_t... Pins >
+struct GpioPortMap
+{
+	static constexpr std::size_t width = sizeof...(Pins);
+	static_assert(width <= 32, "Only a maximum of 32 pins are supported by a port!");
+
+	struct Group
+	{
+		uint32_t mask{0};	///< data bits of the group
+		int8_t shift{0};	///< port bit position minus data bit position
+	};
+
+	struct Groups
+	{
+		Group groups[width ? width : 1]{};
+		std::size_t count{0};
+	};
+
+	static constexpr Groups
+	computeGroups()
+	{
+		constexpr int8_t pins[]{Pins..., -1};
+		Groups result{};
+		for (std::size_t index = 0; index < width; ++index)
+		{
+			if (pins[index] < 0) continue;
+			const std::size_t bit = width - 1 - index;
+			const int8_t shift = pins[index] - int8_t(bit);
+			std::size_t group = 0;
+			while (group < result.count and result.groups[group].shift != shift) group++;
+			if (group == result.count) result.groups[result.count++].shift = shift;
+			result.groups[group].mask |= 1ul << bit;
+		}
+		return result;
+	}
+
+	static constexpr Groups groups = computeGroups();
+
+	/// Number of shift and mask operations per access
+	static constexpr std::size_t
+	count() { return groups.count; }
+
+	/// @returns the data bits from the port bits
+	template< typename Data, typename Port >
+	static constexpr Data
+	gather(Port port)
+	{
+		return gather<Data>(port, std::make_index_sequence<groups.count>());
+	}
+
+	/// @returns the port bits from the data bits
+	template< typename Port, typename Data >
+	static constexpr Port
+	scatter(Data data)
+	{
+		return scatter<Port>(data, std::make_index_sequence<groups.count>());
+	}
+
+private:
+	template< typename Data, typename Port, std::size_t... Index >
+	static constexpr Data
+	gather(Port port, std::index_sequence<Index...>)
+	{
+		return Data((gatherGroup<Data, Index>(port) | ... | Data(0)));
+	}
+
+	template< typename Port, typename Data, std::size_t... Index >
+	static constexpr Port
+	scatter(Data data, std::index_sequence<Index...>)
+	{
+		return Port((scatterGroup<Port, Index>(data) | ... | Port(0)));
+	}
+
+	template< typename Data, std::size_t Index, typename Port >
+	static constexpr Data
+	gatherGroup(Port port)
+	{
+		constexpr Group group = groups.groups[Index];
+		if constexpr (group.shift >= 0)
+			return Data(port >> group.shift) & Data(group.mask);
+		else
+			return Data(Data(port) << -group.shift) & Data(group.mask);
+	}
+
+	template< typename Port, std::size_t Index, typename Data >
+	static constexpr Port
+	scatterGroup(Data data)
+	{
+		constexpr Group group = groups.groups[Index];
+		if constexpr (group.shift >= 0)
+			return Port(Port(data & Data(group.mask)) << group.shift);
+		else
+			return Port((data & Data(group.mask)) >> -group.shift);
+	}
+};
+
+} // namespace detail
+/// @endcond
+
+} // namespace modm::platform
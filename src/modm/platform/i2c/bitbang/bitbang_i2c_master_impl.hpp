@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2010-2012, Fabian Greif
  * Copyright (c) 2011, Georgi Grinshpun
- * Copyright (c) 2012-2017, Niklas Hauser
+ * Copyright (c) 2012-2017, 2026, Niklas Hauser
  * Copyright (c) 2013, David Hebbeker
  * Copyright (c) 2013, Kevin Läufer
  * Copyright (c) 2014, Sascha Schade
@@ -51,8 +51,8 @@ template< class SystemClock, modm::baudrate_t baudrate, modm::percent_t toleranc
 void
 modm::platform::BitBangI2cMaster<Scl, Sda>::initialize()
 {
-	delayTime = 250'000'000ul / baudrate;
-	if (delayTime == 0) delayTime = 1;
+	constexpr uint16_t quarterPeriod = Shifter::quarterPeriod(SystemClock::Frequency, baudrate);
+	delayTime = quarterPeriod;
 
 	SCL::set();
 	SDA::set();
@@ -133,14 +133,9 @@ modm::platform::BitBangI2cMaster<Scl, Sda>::start(modm::I2cTransaction *transact
 						case modm::I2c::Operation::Read:
 							// ask TO about reading
 							reading = transactionObject->reading();
-							while (reading.length > 1)
-							{
-								// continue reading, by sending ACKs
-								if (not read(*reading.buffer++, ACK)) return true;
-								reading.length--;
-							}
-							// read last byte, conclude with NACK
-							if (not read(*reading.buffer, NACK)) return true;
+							DEBUG_SW_I2C('R');
+							// read the entire buffer, conclude with NACK
+							if (not check(Shifter::read(reading.buffer, reading.length, delayTime))) return true;
 							// what next?
 							nextOperation = static_cast<modm::I2c::Operation>(reading.next);
 							break;
@@ -148,12 +143,9 @@ modm::platform::BitBangI2cMaster<Scl, Sda>::start(modm::I2cTransaction *transact
 						case modm::I2c::Operation::Write:
 							// ask TO about writing
 							writing = transactionObject->writing();
-							while (writing.length > 0)
-							{
-								// write the entire buffer
-								if (not write(*writing.buffer++)) return true;
-								writing.length--;
-							}
+							DEBUG_SW_I2C('W');
+							// write the entire buffer
+							if (not check(Shifter::write(writing.buffer, writing.length, delayTime))) return true;
 							// what next?
 							nextOperation = static_cast<modm::I2c::Operation>(writing.next);
 							break;
@@ -292,20 +284,7 @@ template <class Scl, class Sda>
 bool
 modm::platform::BitBangI2cMaster<Scl, Sda>::sclSetAndWait()
 {
-	SCL::set();
-	// wait for clock stretching by slave
-	// only wait a maximum of 250 half clock cycles
-	uint_fast8_t deadlockPreventer = 250;
-	while (SCL::read() == modm::Gpio::Low && deadlockPreventer)
-	{
-		delay4();
-		deadlockPreventer--;
-		// double the read amount
-		if (SCL::read() == modm::Gpio::High) return true;
-		delay4();
-	}
-	// if extreme clock stretching occurs, then there might be an external error
-	return deadlockPreventer > 0;
+	return Shifter::sclSetAndWait(delayTime);
 }
 
 // ----------------------------------------------------------------------------
@@ -315,122 +294,22 @@ bool
 modm::platform::BitBangI2cMaster<Scl, Sda>::write(uint8_t data)
 {
 	DEBUG_SW_I2C('W');
-	// shift through all 8 bits
-	for(uint_fast8_t i = 0; i < 8; ++i)
-	{
-		if (not writeBit(data & 0x80))
-		{
-			// arbitration error
-			error(Error::ArbitrationLost);
-			return false;
-		}
-		data <<= 1;
-	}
-
-	// release sda
-	SDA::set();
-	delay2();
-
-	// rising clock edge for acknowledge bit
-	if (not sclSetAndWait())
-	{
-		// the slave is allowed to stretch the clock, but not unreasonably long!
-		error(Error::BusCondition);
-		return false;
-	}
-	// sample the data line for acknowledge bit
-	if(SDA::read() == modm::Gpio::High)
-	{
-		DEBUG_SW_I2C('n');
-		// we have not received an ACK
-		// depending on context, this could be AddressNack or DataNack
-		error(starting.address ? Error::AddressNack : Error::DataNack);
-		return false;
-	}
-	DEBUG_SW_I2C('a');
-	delay2();
-	// falling clock edge
-	SCL::reset();
-
-	return true;
+	return check(Shifter::write(data, delayTime));
 }
 
 template <class Scl, class Sda>
 bool
-modm::platform::BitBangI2cMaster<Scl, Sda>::read(uint8_t &data, bool ack)
+modm::platform::BitBangI2cMaster<Scl, Sda>::check(Error result)
 {
-	DEBUG_SW_I2C('R');
-	// release data line
-	SDA::set();
-
-	// shift through the 8 bits
-	data = 0;
-	for(uint_fast8_t i = 0; i < 8; ++i)
-	{
-		data <<= 1;
-		if (not readBit(data))
-		{
-			// slaves don't stretch the clock here
-			// this must be arbitration.
-			error(Error::ArbitrationLost);
-			return false;
-		}
-	}
-
-	DEBUG_SW_I2C(ack ? 'A' : 'N');
-	// generate acknowledge bit
-	if (not writeBit(not ack))
-	{
-		// arbitration too
-		error(Error::ArbitrationLost);
-		return false;
-	}
-	// release data line
-	SDA::set();
-	return true;
-}
-
-// ----------------------------------------------------------------------------
-// MARK: - bit operations
-template <class Scl, class Sda>
-bool
-modm::platform::BitBangI2cMaster<Scl, Sda>::writeBit(bool bit)
-{
-	// set the data pin
-	SDA::set(bit);
-	delay2();
-
-	// rising clock edge, the slave samples the data line now
-	if ((SDA::read() == bit) && sclSetAndWait())
-	{
-		delay2();
-		// falling clock edge
-		SCL::reset();
-		// everything ok
+	if (result == Error::NoError) {
+		DEBUG_SW_I2C('a');
 		return true;
 	}
-	// too much clock stretching
-	return false;
-}
-
-template <class Scl, class Sda>
-bool
-modm::platform::BitBangI2cMaster<Scl, Sda>::readBit(uint8_t &data)
-{
-	// slave sets data line
-	delay2();
-	// rising clock edge, the master samples the data line now
-	if (sclSetAndWait())
-	{
-		// copy bit into data
-		if(SDA::read() == modm::Gpio::High)
-			data |= 0x01;
-
-		delay2();
-		// falling clock edge
-		SCL::reset();
-		return true;
+	// we have not received an ACK
+	// depending on context, this could be AddressNack or DataNack
+	if (result == Error::DataNack and starting.address) {
+		result = Error::AddressNack;
 	}
-	// too much clock stretching
+	error(result);
 	return false;
 }
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <modm/architecture/interface/delay.hpp>
+#include <modm/architecture/interface/gpio.hpp>
+#include <modm/architecture/interface/i2c_master.hpp>
+
+namespace modm::platform
+{
+
+/// @cond
+namespace detail
+{
+
+/**
+ * Byte and buffer transfers of the software I2C master.
+ *
+ * The eight data bits of a byte are unrolled at compile time, so that every
+ * bit compiles into a fixed sequence of pin accesses and delays. Buffers are
+ * transferred in one call instead of byte by byte through the transaction.
+ *
+ * @tparam	Scl		open-drain clock pin
+ * @tparam	Sda		open-drain data pin
+ * @tparam	Delay	busy waits for the given nanoseconds
+ */
+template< class Scl, class Sda, void(*Delay)(uint32_t) = ::modm::delay_ns >
+struct BitBangI2cShifter
+{
+	using Error = ::modm::I2cMaster::Error;
+
+	/// Estimated CPU cycles spent in a quarter clock period besides the delay
+	static constexpr uint32_t OverheadCycles = 12;
+
+	/// @returns a quarter of the clock period in nanoseconds minus the
+	///			 time it takes to access the pins at the CPU frequency.
+	static constexpr uint16_t
+	quarterPeriod(uint32_t frequency, uint32_t baudrate)
+	{
+		const uint32_t period = 250'000'000ul / baudrate;
+		const uint32_t overhead = uint64_t(OverheadCycles) * 1'000'000'000ull / frequency;
+		if (period <= overhead) return 0;
+		return std::min<uint32_t>(period - overhead, UINT16_MAX);
+	}
+
+	/// release the clock and wait for any slaves to release it too
+	/// @return	`true` if success, `false` if slave stretched the clock for too long
+	static bool
+	sclSetAndWait(uint16_t delay)
+	{
+		Scl::set();
+		// wait for clock stretching by slave
+		// only wait a maximum of 250 half clock cycles
+		uint_fast8_t deadlockPreventer = 250;
+		while (Scl::read() == modm::Gpio::Low && deadlockPreventer)
+		{
+			wait(delay);
+			deadlockPreventer--;
+			// double the read amount
+			if (Scl::read() == modm::Gpio::High) return true;
+			wait(delay);
+		}
+		// if extreme clock stretching occurs, then there might be an external error
+		return deadlockPreventer > 0;
+	}
+
+	/// write one byte to the bus and receive the acknowledge bit
+	/// @return	`ArbitrationLost`, `BusCondition` for too much clock stretching,
+	///			`DataNack` if no acknowledge was received, otherwise `NoError`.
+	static Error
+	write(uint8_t data, uint16_t delay)
+	{
+		const bool written = [&]<std::size_t... Bit>(std::index_sequence<Bit...>)
+		{
+			return (writeBit(data & (0x80u >> Bit), delay) and ...);
+		}(std::make_index_sequence<8>());
+		if (not written) return Error::ArbitrationLost;
+
+		// release sda
+		Sda::set();
+		wait(2*delay);
+
+		// rising clock edge for acknowledge bit
+		// the slave is allowed to stretch the clock, but not unreasonably long!
+		if (not sclSetAndWait(delay)) return Error::BusCondition;
+
+		// sample the data line for acknowledge bit
+		if (Sda::read() == modm::Gpio::High) return Error::DataNack;
+
+		wait(2*delay);
+		// falling clock edge
+		Scl::reset();
+		return Error::NoError;
+	}
+
+	/// write the entire buffer, stopping at the first error
+	static Error
+	write(const uint8_t *data, std::size_t length, uint16_t delay)
+	{
+		for (; length; length--)
+		{
+			if (const Error error = write(*data++, delay); error != Error::NoError)
+				return error;
+		}
+		return Error::NoError;
+	}
+
+	/// read one byte from the bus
+	/// @param	ack	acknowledge bit of read operation, `true` for ACK
+	/// @return	`ArbitrationLost` if the data line could not be driven, otherwise `NoError`.
+	static Error
+	read(uint8_t &data, bool ack, uint16_t delay)
+	{
+		// release data line
+		Sda::set();
+
+		// slaves don't stretch the clock here, this must be arbitration.
+		data = 0;
+		const bool received = [&]<std::size_t... Bit>(std::index_sequence<Bit...>)
+		{
+			return (readBit(data, 0x80u >> Bit, delay) and ...);
+		}(std::make_index_sequence<8>());
+		if (not received) return Error::ArbitrationLost;
+
+		// generate acknowledge bit
+		if (not writeBit(not ack, delay)) return Error::ArbitrationLost;
+
+		// release data line
+		Sda::set();
+		return Error::NoError;
+	}
+
+	/// read the entire buffer, acknowledging all but the last byte
+	static Error
+	read(uint8_t *data, std::size_t length, uint16_t delay)
+	{
+		while (length > 1)
+		{
+			// continue reading, by sending ACKs
+			if (const Error error = read(*data++, true, delay); error != Error::NoError)
+				return error;
+			length--;
+		}
+		// read last byte, conclude with NACK
+		return read(*data, false, delay);
+	}
+
+private:
+	static void
+	wait(uint32_t delay)
+	{
+		if (delay) Delay(delay);
+	}
+
+	/// write one bit to the bus
+	/// @return	`true` if success, `false` if the bit was overwritten or slave
+	///			stretched the clock for too long
+	static bool
+	writeBit(bool bit, uint16_t delay)
+	{
+		// set the data pin
+		Sda::set(bit);
+		wait(2*delay);
+
+		// rising clock edge, the slave samples the data line now
+		if ((Sda::read() == bit) && sclSetAndWait(delay))
+		{
+			wait(2*delay);
+			// falling clock edge
+			Scl::reset();
+			return true;
+		}
+		return false;
+	}
+
+	/// read one bit from the bus into the mask of data
+	/// @return	`true` if success, `false` if slave stretched the clock for too long
+	static bool
+	readBit(uint8_t &data, uint8_t mask, uint16_t delay)
+	{
+		// slave sets data line
+		wait(2*delay);
+		// rising clock edge, the master samples the data line now
+		if (sclSetAndWait(delay))
+		{
+			if (Sda::read() == modm::Gpio::High) data |= mask;
+
+			wait(2*delay);
+			// falling clock edge
+			Scl::reset();
+			return true;
+		}
+		return false;
+	}
+};
+
+}	// namespace detail
+/// @endcond
+
+}	// namespace modm::platform
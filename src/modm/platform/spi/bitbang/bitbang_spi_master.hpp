@@ -2,7 +2,7 @@
  * Copyright (c) 2009-2012, Fabian Greif
  * Copyright (c) 2010, Georgi Grinshpun
  * Copyright (c) 2010, Thorsten Lajewski
- * Copyright (c) 2012-2017, Niklas Hauser
+ * Copyright (c) 2012-2017, 2026, Niklas Hauser
  * Copyright (c) 2014, Sascha Schade
  *
  * This file is part of the modm project.
@@ -21,6 +21,7 @@
 #include <modm/architecture/interface/spi_master.hpp>
 #include <modm/architecture/interface/delay.hpp>
 #include <modm/platform/gpio/connector.hpp>
+#include "bitbang_spi_shifter.hpp"
 
 namespace modm
 {
@@ -31,6 +32,9 @@ namespace platform
 /**
  * Software emulation of a Simple Spi.
  *
+ * The data mode and order are resolved once per transfer, the bits of every
+ * byte are then shifted by an unrolled sequence of pin accesses.
+ *
  * @tparam	Sck			clock pin [output]
  * @tparam	Mosi		master out slave in pin [output]
  * @tparam	Miso		master in slave out pin [input]
@@ -51,6 +55,8 @@ public:
 	connect();
 
 	/// Baudrate is limited to 500kbps.
+	/// The delay between clock edges is reduced by the estimated time it takes
+	/// to access the pins at the `SystemClock::Frequency`.
 	template< class SystemClock, baudrate_t baudrate, percent_t tolerance=pct(5) >
 	static void
 	initialize();
@@ -74,8 +80,7 @@ public:
 	transfer(const uint8_t *tx, uint8_t *rx, std::size_t length);
 
 private:
-	static void
-	delay();
+	using Shifter = detail::BitBangSpiShifter<Sck, Mosi, Miso>;
 
 	static uint16_t delayTime;
 
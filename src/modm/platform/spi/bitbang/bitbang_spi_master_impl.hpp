@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2009-2010, Martin Rosekeit
- * Copyright (c) 2012-2017, Niklas Hauser
+ * Copyright (c) 2012-2017, 2026, Niklas Hauser
  * Copyright (c) 2014, Sascha Schade
  * Copyright (c) 2018, Raphael Lehmann
  * Copyright (c) 2020, Erik Henriksson
@@ -55,8 +55,8 @@ template< class SystemClock, modm::baudrate_t baudrate, modm::percent_t toleranc
 void
 modm::platform::BitBangSpiMaster<Sck, Mosi, Miso>::initialize()
 {
-	delayTime = 500'000'000ul / baudrate;
-	if (delayTime == 0) delayTime = 1;
+	constexpr uint16_t halfPeriod = Shifter::halfPeriod(SystemClock::Frequency, baudrate);
+	delayTime = halfPeriod;
 
 	Sck::reset();
 	Mosi::reset();
@@ -84,50 +84,18 @@ template <typename Sck, typename Mosi, typename Miso>
 uint8_t
 modm::platform::BitBangSpiMaster<Sck, Mosi, Miso>::transferBlocking(uint8_t data)
 {
-	for (uint_fast8_t ii = 0; ii < 8; ++ii)
+	switch (operationMode & 0b111)
 	{
-		// CPHA=1, sample on falling edge
-		if (operationMode & 0b01)
-			delay();
-
-		// if LSB first
-		if (operationMode & 0b100) {
-			Mosi::set(data & 0x01);
-			data >>= 1;
-		}
-		else {
-			Mosi::set(data & 0x80);
-			data <<= 1;
-		}
-
-		// CPHA=0, sample on rising edge
-		if (not (operationMode & 0b01))
-			delay();
-
-		// CPOL=0 -> High, CPOL=1 -> Low
-		Sck::set(not (operationMode & 0b10));
-
-		// CPHA=1, sample on falling edge
-		if (operationMode & 0b01)
-			delay();
-
-		// if LSB first
-		if (operationMode & 0b100) {
-			if (Miso::read()) data |= 0x80;
-		}
-		else {
-			if (Miso::read()) data |= 0x01;
-		}
-
-		// CPHA=0, sample on rising edge
-		if (not (operationMode & 0b01))
-			delay();
-
-		// CPOL=0 -> Low, CPOL=1 -> High
-		Sck::set(operationMode & 0b10);
+		default:
+		case 0b000: return Shifter::template transfer<0b000>(data, delayTime);
+		case 0b001: return Shifter::template transfer<0b001>(data, delayTime);
+		case 0b010: return Shifter::template transfer<0b010>(data, delayTime);
+		case 0b011: return Shifter::template transfer<0b011>(data, delayTime);
+		case 0b100: return Shifter::template transfer<0b100>(data, delayTime);
+		case 0b101: return Shifter::template transfer<0b101>(data, delayTime);
+		case 0b110: return Shifter::template transfer<0b110>(data, delayTime);
+		case 0b111: return Shifter::template transfer<0b111>(data, delayTime);
 	}
-
-	return data;
 }
 
 template <typename Sck, typename Mosi, typename Miso>
@@ -135,16 +103,18 @@ void
 modm::platform::BitBangSpiMaster<Sck, Mosi, Miso>::transferBlocking(
 		const uint8_t *tx, uint8_t *rx, std::size_t length)
 {
-	uint8_t tx_byte = 0xff;
-	uint8_t rx_byte;
-
-	for (std::size_t i = 0; i < length; i++)
+	// resolve the data mode and order only once for the entire buffer
+	switch (operationMode & 0b111)
 	{
-		if (tx) tx_byte = tx[i];
-
-		rx_byte = transferBlocking(tx_byte);
-
-		if (rx) rx[i] = rx_byte;
+		default:
+		case 0b000: Shifter::template transfer<0b000>(tx, rx, length, delayTime); break;
+		case 0b001: Shifter::template transfer<0b001>(tx, rx, length, delayTime); break;
+		case 0b010: Shifter::template transfer<0b010>(tx, rx, length, delayTime); break;
+		case 0b011: Shifter::template transfer<0b011>(tx, rx, length, delayTime); break;
+		case 0b100: Shifter::template transfer<0b100>(tx, rx, length, delayTime); break;
+		case 0b101: Shifter::template transfer<0b101>(tx, rx, length, delayTime); break;
+		case 0b110: Shifter::template transfer<0b110>(tx, rx, length, delayTime); break;
+		case 0b111: Shifter::template transfer<0b111>(tx, rx, length, delayTime); break;
 	}
 }
 
@@ -170,12 +140,3 @@ modm::platform::BitBangSpiMaster<Sck, Mosi, Miso>::transfer(
 	return {modm::rf::Stop, 0};
 #endif
 }
-
-// ----------------------------------------------------------------------------
-
-template <typename Sck, typename Mosi, typename Miso>
-void
-modm::platform::BitBangSpiMaster<Sck, Mosi, Miso>::delay()
-{
-	modm::delay_ns(delayTime);
-}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <modm/architecture/interface/delay.hpp>
+
+namespace modm::platform
+{
+
+/// @cond
+namespace detail
+{
+
+/**
+ * Bit shifting of the software SPI master.
+ *
+ * The SPI mode and bit order are template arguments, so that every one of
+ * the eight combinations compiles into an unrolled sequence of pin accesses
+ * and delays without branching on the configuration for every bit.
+ *
+ * @tparam	Delay	busy waits for the given nanoseconds
+ */
+template< class Sck, class Mosi, class Miso, void(*Delay)(uint32_t) = ::modm::delay_ns >
+struct BitBangSpiShifter
+{
+	/// bit 0: CPHA, bit 1: CPOL, bit 2: LSB first
+	using Mode = uint8_t;
+
+	/// Estimated CPU cycles spent between two clock edges besides the delay
+	static constexpr uint32_t OverheadCycles = 8;
+
+	/// @returns the delay between two clock edges in nanoseconds minus the
+	///			 time it takes to access the pins at the CPU frequency.
+	static constexpr uint16_t
+	halfPeriod(uint32_t frequency, uint32_t baudrate)
+	{
+		const uint32_t period = 500'000'000ul / baudrate;
+		const uint32_t overhead = uint64_t(OverheadCycles) * 1'000'000'000ull / frequency;
+		if (period <= overhead) return 0;
+		return std::min<uint32_t>(period - overhead, UINT16_MAX);
+	}
+
+	template< Mode mode >
+	static uint8_t
+	transfer(uint8_t tx, uint16_t delay)
+	{
+		uint8_t rx{0};
+		[&]<std::size_t... Bit>(std::index_sequence<Bit...>)
+		{
+			((rx |= transferBit<mode, Bit>(tx, delay)), ...);
+		}(std::make_index_sequence<8>());
+		return rx;
+	}
+
+	template< Mode mode >
+	static void
+	transfer(const uint8_t *tx, uint8_t *rx, std::size_t length, uint16_t delay)
+	{
+		for (std::size_t index = 0; index < length; ++index)
+		{
+			const uint8_t data = transfer<mode>(tx ? tx[index] : 0xff, delay);
+			if (rx) rx[index] = data;
+		}
+	}
+
+private:
+	static void
+	wait(uint32_t delay)
+	{
+		if (delay) Delay(delay);
+	}
+
+	template< Mode mode, std::size_t Bit >
+	static uint8_t
+	transferBit(uint8_t tx, uint16_t delay)
+	{
+		constexpr bool cpha = mode & 0b001;
+		constexpr bool cpol = mode & 0b010;
+		constexpr uint8_t mask = (mode & 0b100) ? (1u << Bit) : (0x80u >> Bit);
+
+		// CPHA=1, sample on falling edge
+		if constexpr (cpha) wait(delay);
+		Mosi::set(tx & mask);
+		// CPHA=0, sample on rising edge
+		if constexpr (not cpha) wait(delay);
+
+		// CPOL=0 -> High, CPOL=1 -> Low
+		Sck::set(not cpol);
+
+		if constexpr (cpha) wait(delay);
+		const uint8_t rx = Miso::read() ? mask : 0;
+		if constexpr (not cpha) wait(delay);
+
+		// CPOL=0 -> Low, CPOL=1 -> High
+		Sck::set(cpol);
+		return rx;
+	}
+};
+
+}	// namespace detail
+/// @endcond
+
+}	// namespace modm::platform
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "task.hpp"
+#include <modm/processing/resumable.hpp>
+#include <modm/processing/timer.hpp>
+#include <type_traits>
+
+namespace modm::coro
+{
+
+/// @cond
+namespace detail
+{
+
+/// Suspends the coroutine until `Awaitable::await_ready()` returns `true`.
+/// The awaitable is a temporary of the `co_await` expression and therefore
+/// lives in the coroutine frame until the coroutine is resumed.
+template< class Awaitable >
+struct Poll
+{
+	template< class Promise >
+	void
+	await_suspend(std::coroutine_handle<Promise> handle)
+	{
+		handle.promise().suspend(handle, [](void* self)
+		{
+			return static_cast<Awaitable*>(self)->await_ready();
+		}, static_cast<Awaitable*>(this));
+	}
+};
+
+struct Yield
+{
+	bool await_ready() { return false; }
+	void await_resume() {}
+
+	template< class Promise >
+	void
+	await_suspend(std::coroutine_handle<Promise> handle)
+	{ handle.promise().suspend(handle); }
+};
+
+template< class Rep, class Period >
+using TimeoutFor = std::conditional_t<
+	std::is_convertible_v<std::chrono::duration<Rep, Period>,
+						  std::chrono::duration<Rep, std::milli>>,
+	modm::GenericTimeout< modm::chrono::milli_clock, modm::chrono::milli_clock::duration>,
+	modm::GenericTimeout< modm::chrono::micro_clock, modm::chrono::micro_clock::duration>
+>;
+
+template< class Timeout >
+class Sleep : public Poll< Sleep<Timeout> >
+{
+	Timeout timeout;
+public:
+	template< class Duration >
+	Sleep(Duration interval) : timeout(interval) {}
+
+	bool await_ready() { return timeout.isExpired(); }
+	void await_resume() {}
+};
+
+template< class Condition >
+class Until : public Poll< Until<Condition> >
+{
+	Condition condition;
+public:
+	Until(Condition&& condition) : condition(std::forward<Condition>(condition)) {}
+
+	bool await_ready() { return condition(); }
+	void await_resume() {}
+};
+
+template< class Condition, class Timeout >
+class UntilFor : public Poll< UntilFor<Condition, Timeout> >
+{
+	Condition condition;
+	Timeout timeout;
+	bool result{false};
+public:
+	template< class Duration >
+	UntilFor(Condition&& condition, Duration interval) :
+		condition(std::forward<Condition>(condition)), timeout(interval) {}
+
+	bool await_ready() { return (result = condition()) or timeout.isExpired(); }
+	bool await_resume() { return result; }
+};
+
+template< class Function >
+class Call : public Poll< Call<Function> >
+{
+	using Result = std::invoke_result_t<Function&>;
+	static constexpr bool IsResumable = requires(Result r) { r.getState(); };
+	static constexpr bool IsVoid = std::is_void_v<Result>;
+
+	Function function;
+	std::optional<std::conditional_t<IsVoid, bool, Result>> result;
+public:
+	Call(Function&& function) : function(std::forward<Function>(function)) {}
+
+	bool
+	await_ready()
+	{
+		if constexpr (IsVoid) {
+			function();
+			return true;
+		} else {
+			result.emplace(function());
+			if constexpr (IsResumable)
+				return result->getState() <= modm::rf::NestingError;
+			return true;
+		}
+	}
+
+	auto
+	await_resume()
+	{
+		if constexpr (IsVoid) return;
+		else if constexpr (IsResumable) return result->getResult();
+		else return std::move(*result);
+	}
+};
+
+} // namespace detail
+/// @endcond
+
+/// @ingroup modm_processing_coroutine
+/// @{
+
+/**
+ * Suspends the coroutine once, so that `Task::run()` returns to the main loop.
+ * The coroutine is resumed on the next call to `Task::run()`.
+ *
+ * `co_await modm::coro::yield();`
+ */
+inline detail::Yield
+yield()
+{
+	return {};
+}
+
+/**
+ * Suspends the coroutine until the time interval has elapsed.
+ * This uses a `modm::Timeout` if interval ≥1ms or a `modm::PreciseTimeout`
+ * if interval ≥1µs.
+ *
+ * `co_await modm::coro::sleep(10ms);`
+ */
+template< typename Rep, typename Period >
+auto
+sleep(std::chrono::duration<Rep, Period> interval)
+{
+	return detail::Sleep< detail::TimeoutFor<Rep, Period> >(interval);
+}
+
+/**
+ * Suspends the coroutine until the condition returns `true`.
+ * The condition is evaluated on every call to `Task::run()`.
+ *
+ * `co_await modm::coro::until([]{ return Button::read(); });`
+ */
+template< class Condition >
+auto
+until(Condition&& condition)
+{
+	return detail::Until<Condition>(std::forward<Condition>(condition));
+}
+
+/**
+ * Suspends the coroutine until the condition returns `true` or the time
+ * interval has elapsed.
+ *
+ * `if (not co_await modm::coro::until(condition, 10ms)) timeout();`
+ *
+ * @returns `true` if the condition was fulfilled, `false` on timeout.
+ */
+template< class Condition, typename Rep, typename Period >
+auto
+until(Condition&& condition, std::chrono::duration<Rep, Period> interval)
+{
+	return detail::UntilFor<Condition, detail::TimeoutFor<Rep, Period>>(
+			std::forward<Condition>(condition), interval);
+}
+
+/**
+ * Polls a resumable function until it finishes and returns its result, just
+ * like `RF_CALL()`. This allows coroutines to use all drivers implemented
+ * with resumable functions, including all I2C and SPI transactions.
+ * When resumable functions are implemented with fibers, the function is
+ * called once and blocks.
+ *
+ * `const bool found = co_await modm::coro::call([&]{ return sensor.ping(); });`
+ *
+ * @param function	a callable returning a `modm::ResumableResult`. It is
+ *					stored in the coroutine frame until the function finished.
+ */
+template< class Function >
+auto
+call(Function&& function)
+{
+	return detail::Call<Function>(std::forward<Function>(function));
+}
+
+/// @}
+
+} // namespace modm::coro
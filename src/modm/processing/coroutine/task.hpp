@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "frame.hpp"
+#include <modm/architecture/interface/assert.hpp>
+#include <coroutine>
+#include <optional>
+#include <utility>
+
+namespace modm::coro
+{
+
+template< class T > class Task;
+
+/// @cond
+namespace detail
+{
+
+struct FinalAwaiter
+{
+	bool await_ready() noexcept { return false; }
+	void await_resume() noexcept {}
+
+	template< class Promise >
+	std::coroutine_handle<>
+	await_suspend(std::coroutine_handle<Promise> handle) noexcept
+	{
+		// symmetric transfer back into the awaiting coroutine
+		if (auto continuation = handle.promise().continuation)
+			return continuation;
+		return std::noop_coroutine();
+	}
+};
+
+struct PromiseBase
+{
+	/// The coroutine awaiting this one or empty for the outermost coroutine.
+	std::coroutine_handle<> continuation;
+	/// The outermost coroutine which is polled by `Task::run()`.
+	PromiseBase* root{this};
+	/// Only valid in the root: the innermost suspended coroutine and the
+	/// condition to resume it or `nullptr` to resume unconditionally.
+	std::coroutine_handle<> leaf;
+	bool (*ready)(void*){nullptr};
+	void* awaitable{nullptr};
+
+	void
+	suspend(std::coroutine_handle<> handle, bool (*condition)(void*) = nullptr, void* object = nullptr)
+	{
+		root->leaf = handle;
+		root->ready = condition;
+		root->awaitable = object;
+	}
+
+	static void*
+	operator new(size_t size)
+	{
+		void* frame = framePool.allocate(size);
+		modm_assert(frame, "coro.frame",
+				"Coroutine frame is too large or the frame pool is exhausted!", size);
+		return frame;
+	}
+
+	static void
+	operator delete(void* frame) noexcept
+	{
+		framePool.release(frame);
+	}
+
+	std::suspend_always
+	initial_suspend() noexcept
+	{ return {}; }
+
+	FinalAwaiter
+	final_suspend() noexcept
+	{ return {}; }
+
+	void
+	unhandled_exception()
+	{
+		modm_assert(false, "coro.exc", "Unhandled exception in coroutine!");
+	}
+};
+
+template< class T >
+struct Promise : public PromiseBase
+{
+	std::optional<T> value;
+
+	Task<T>
+	get_return_object();
+
+	template< class U >
+	void
+	return_value(U&& result)
+	{ value.emplace(std::forward<U>(result)); }
+
+	T
+	result()
+	{ return std::move(*value); }
+
+	std::coroutine_handle<Promise>
+	handle()
+	{ return std::coroutine_handle<Promise>::from_promise(*this); }
+};
+
+template< class T >
+struct TaskAwaiter
+{
+	std::coroutine_handle< Promise<T> > child;
+
+	bool
+	await_ready() noexcept
+	{ return child.done(); }
+
+	template< class Parent >
+	std::coroutine_handle<>
+	await_suspend(std::coroutine_handle<Parent> parent) noexcept
+	{
+		child.promise().continuation = parent;
+		child.promise().root = parent.promise().root;
+		return child;
+	}
+
+	T
+	await_resume()
+	{ return child.promise().result(); }
+};
+
+template<>
+struct Promise<void> : public PromiseBase
+{
+	Task<void>
+	get_return_object();
+
+	void
+	return_void() {}
+
+	void
+	result() {}
+
+	std::coroutine_handle<Promise>
+	handle()
+	{ return std::coroutine_handle<Promise>::from_promise(*this); }
+};
+
+} // namespace detail
+/// @endcond
+
+/**
+ * A stackless coroutine returning a value of type `T`.
+ *
+ * A task starts suspended and is either polled by calling `run()` from the
+ * main loop, or `co_await`ed by another task, which then runs it to
+ * completion as part of itself. The call hierarchy is kept in the coroutine
+ * frames, so that polling the outermost task resumes the innermost suspended
+ * task directly without re-entering every caller.
+ *
+ * Coroutines may only suspend on the awaitables in the `modm::coro`
+ * namespace, since these register the suspended coroutine and its resume
+ * condition with the outermost task.
+ *
+ * ```cpp
+ * modm::coro::Task<uint8_t> read(uint8_t address);
+ * modm::coro::Task<> blink()
+ * {
+ *     while (true)
+ *     {
+ *         Led::toggle();
+ *         const uint8_t value = co_await read(0x10);
+ *         co_await modm::coro::sleep(value * 1ms);
+ *     }
+ * }
+ * auto task = blink();
+ * while (true) task.run();
+ * ```
+ *
+ * @ingroup modm_processing_coroutine
+ */
+template< class T = void >
+class [[nodiscard]] Task
+{
+public:
+	using promise_type = detail::Promise<T>;
+
+	Task(const Task&) = delete;
+	Task& operator=(const Task&) = delete;
+
+	Task(Task&& other) noexcept :
+		handle(std::exchange(other.handle, nullptr)) {}
+
+	Task&
+	operator=(Task&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (handle) handle.destroy();
+			handle = std::exchange(other.handle, nullptr);
+		}
+		return *this;
+	}
+
+	~Task()
+	{
+		if (handle) handle.destroy();
+	}
+
+	/// @returns `true` if the coroutine has not finished yet.
+	bool
+	isRunning() const
+	{
+		return handle and not handle.done();
+	}
+
+	/**
+	 * Resumes the innermost suspended coroutine if its condition is fulfilled.
+	 * This must only be called on the outermost task.
+	 *
+	 * @returns `true` if the coroutine has not finished yet.
+	 */
+	bool
+	run()
+	{
+		if (not isRunning()) return false;
+		detail::PromiseBase& root = handle.promise();
+		if (root.ready and not root.ready(root.awaitable)) return true;
+		root.ready = nullptr;
+		root.leaf.resume();
+		return not handle.done();
+	}
+
+	/// @returns the return value of the finished coroutine.
+	T
+	getResult()
+	{
+		return handle.promise().result();
+	}
+
+	/// Runs the task as part of the awaiting coroutine and returns its result.
+	detail::TaskAwaiter<T>
+	operator co_await() noexcept
+	{ return {handle}; }
+
+private:
+	friend promise_type;
+
+	explicit Task(std::coroutine_handle<promise_type> handle) :
+		handle(handle)
+	{
+		handle.promise().leaf = handle;
+	}
+
+	std::coroutine_handle<promise_type> handle;
+};
+
+/// @cond
+namespace detail
+{
+
+template< class T >
+Task<T>
+Promise<T>::get_return_object()
+{ return Task<T>(handle()); }
+
+inline Task<void>
+Promise<void>::get_return_object()
+{ return Task<void>(handle()); }
+
+} // namespace detail
+/// @endcond
+
+} // namespace modm::coro
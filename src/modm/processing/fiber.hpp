@@ -10,5 +10,6 @@
 // ----------------------------------------------------------------------------
 
 #include "fiber/fiber.hpp"
+#include "fiber/pool.hpp"
 #include "fiber/scheduler.hpp"
 #include "fiber/functions.hpp"
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "task.hpp"
+#include <algorithm>
+
+namespace modm::fiber
+{
+
+/**
+ * A fixed number of equally sized stacks that are lent to `PooledTask`s while
+ * they are running. This allows many short-lived fibers to share the memory of
+ * fewer stacks, as long as not all of them are running at the same time.
+ *
+ * The pool is zero-initialized, so it can be used by tasks constructed during
+ * static initialization.
+ *
+ * @tparam Size		size of each stack in bytes.
+ * @tparam Count	number of stacks in the pool.
+ *
+ * @ingroup modm_processing_fiber
+ */
+template< size_t Size = StackSizeDefault, size_t Count = 4 >
+class StackPool
+{
+	StackPool(const StackPool&) = delete;
+	StackPool& operator=(const StackPool&) = delete;
+
+	static_assert(Count > 0, "StackPool must contain at least one stack!");
+
+	Stack<Size> stacks[Count];
+	bool used[Count]{};
+	size_t count{0};
+	size_t peak{0};
+
+public:
+	using StackType = Stack<Size>;
+	static constexpr size_t StackSize = Size;
+	static constexpr size_t StackCount = Count;
+
+	constexpr StackPool() = default;
+
+	/// @returns a free stack or `nullptr` if all stacks are in use.
+	StackType*
+	allocate()
+	{
+		for (size_t ii = 0; ii < Count; ++ii)
+		{
+			if (used[ii]) continue;
+			used[ii] = true;
+			peak = std::max(peak, ++count);
+			return &stacks[ii];
+		}
+		return nullptr;
+	}
+
+	/// Returns the stack to the pool.
+	void
+	release(StackType* stack)
+	{
+		const size_t index = stack - stacks;
+		if (index < Count and used[index])
+		{
+			used[index] = false;
+			count--;
+		}
+	}
+
+	/// @returns the number of stacks currently in use.
+	size_t
+	size() const
+	{ return count; }
+
+	/// @returns the number of free stacks.
+	size_t
+	available() const
+	{ return Count - count; }
+
+	/// @returns the highest number of stacks used at the same time.
+	size_t
+	maxSize() const
+	{ return peak; }
+
+	/// @returns the highest amount of stack memory in bytes used at the same time.
+	size_t
+	maxMemory() const
+	{ return peak * Size; }
+};
+
+/**
+ * A fiber task that only holds a stack from a `StackPool` while it is running.
+ * The stack is allocated in `start()`, which fails if the pool is exhausted,
+ * and returned to the pool when the fiber function returns. The closure is
+ * stored in the task and constructed on the stack on every start.
+ *
+ * With the `modm:processing:fiber:profiling` option enabled, the stack is
+ * watermarked on every start and the highest stack usage including the
+ * closure is recorded when the fiber function returns, so that you can size
+ * a dedicated stack or the pool stack size with `recommended_stack_size()`.
+ *
+ * ```cpp
+ * modm::fiber::StackPool<2048, 2> pool;
+ * modm::fiber::PooledTask task1(pool, function1);
+ * modm::fiber::PooledTask task2(pool, function2, modm::fiber::Start::Later);
+ * ```
+ *
+ * @ingroup modm_processing_fiber
+ */
+template< class Pool, class T >
+class PooledTask : public Task
+{
+	Pool& pool;
+	T closure;
+	typename Pool::StackType* stack{nullptr};
+#if MODM_FIBER_PROFILING
+	size_t maxStackUsage{0};
+#endif
+
+	void
+	finish()
+	{
+#if MODM_FIBER_PROFILING
+		// the closure is constructed above the context top
+		const size_t usage = stack_usage() + (uintptr_t(stack) + sizeof(*stack) - uintptr_t(ctx.top));
+		maxStackUsage = std::max(maxStackUsage, usage);
+#endif
+		// The stack is still used to jump to the next fiber, but cannot be
+		// allocated again before that, since fibers are cooperative.
+		pool.release(stack);
+		stack = nullptr;
+	}
+
+public:
+	/// @param pool		The pool to allocate the stack from.
+	/// @param closure	A callable object of signature `void(*)()`.
+	/// @param start	When to start this task.
+	template< class C >
+	PooledTask(Pool& pool, C&& closure, Start start=Start::Now)
+	: Task(nullptr), pool(pool), closure(std::forward<C>(closure))
+	{
+		if (start == Start::Now) this->start();
+	}
+
+	/// Allocates a stack and adds the task to the currently active scheduler,
+	/// if not already running.
+	/// @returns if the fiber has been scheduled, `false` if no stack is available.
+	bool
+	start()
+	{
+		if (isRunning()) return false;
+		stack = pool.allocate();
+		if (stack == nullptr) return false;
+		initialize(*stack, [this]()
+		{
+			this->closure();
+			finish();
+		});
+#if MODM_FIBER_PROFILING
+		watermark_stack();
+#endif
+		return Task::start();
+	}
+
+	/// @returns if the task currently holds a stack from the pool.
+	bool
+	hasStack() const
+	{
+		return stack;
+	}
+
+#if MODM_FIBER_PROFILING
+	/// @returns the highest stack usage in bytes of all completed runs.
+	size_t
+	max_stack_usage() const
+	{
+		return maxStackUsage;
+	}
+
+	/// @returns the highest stack usage with a 25% margin rounded up to the
+	///          stack alignment, or zero if the fiber never completed.
+	size_t
+	recommended_stack_size() const
+	{
+		if (not maxStackUsage) return 0;
+		const size_t size = std::max(maxStackUsage + maxStackUsage / 4, StackSizeMinimum);
+		return (size + StackAlignment - 1) & ~(StackAlignment - 1);
+	}
+#endif
+};
+
+/// @cond
+template< class Pool, class C >
+PooledTask(Pool&, C&&, Start=Start::Now) -> PooledTask<Pool, std::decay_t<C>>;
+/// @endcond
+
+} // namespace modm::fiber
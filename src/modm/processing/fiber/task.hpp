@@ -12,6 +12,7 @@
 #pragma once
 
 #include "stack.hpp"
+#include "profile.hpp"
 #include "context.h"
 #include <type_traits>
 
@@ -50,12 +51,23 @@ class Task
 	Task(const Task&) = delete;
 	Task& operator=(const Task&) = delete;
 	friend class Scheduler;
+	template< class Pool, class T > friend class PooledTask;
 
 	// Make sure that Task and Fiber use a callable constructor, otherwise they
 	// may get placed in the .data section including the whole stack!!!
 	modm_context_t ctx;
 	Task* next;
 	Scheduler *scheduler{nullptr};
+	[[no_unique_address]] Profile profile_;
+
+	/// Constructs the task without a stack, which must be initialized before
+	/// the task is started.
+	explicit Task(std::nullptr_t) {}
+
+	/// Constructs the closure on the stack and initializes the context.
+	template<size_t Size, class T>
+	void
+	initialize(Stack<Size>& stack, T&& closure);
 
 public:
 	/// @param stack	A stack object that is *NOT* shared with other tasks.
@@ -88,6 +100,23 @@ public:
 		return modm_context_stack_overflow(&ctx);
 	}
 
+	/// @returns a snapshot of the runtime statistics.
+	/// @see `modm:processing:fiber:profiling` option.
+	Profile
+	profile() const
+	{
+		return profile_;
+	}
+
+#if MODM_FIBER_PROFILING
+	/// Clears the runtime statistics.
+	void
+	reset_profile()
+	{
+		profile_.reset();
+	}
+#endif
+
 	/// Adds the task to the currently active scheduler, if not already running.
 	/// @returns if the fiber has been scheduled.
 	bool
@@ -112,6 +141,14 @@ namespace modm::fiber
 
 template<size_t Size, class T>
 Task::Task(Stack<Size>& stack, T&& closure, Start start)
+{
+	initialize(stack, std::forward<T>(closure));
+	if (start == Start::Now) this->start();
+}
+
+template<size_t Size, class T>
+void
+Task::initialize(Stack<Size>& stack, T&& closure)
 {
 	if constexpr (std::is_convertible_v<T, void(*)()>)
 	{
@@ -144,7 +181,6 @@ Task::Task(Stack<Size>& stack, T&& closure, Start start)
 		// initialize the stack below the allocated closure
 		modm_context_init(&ctx, stack.memory, (uintptr_t*)ptr, caller, ptr);
 	}
-	if (start == Start::Now) this->start();
 }
 
 inline bool
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_PERIODIC_SCHEDULER_HPP
+#define MODM_PERIODIC_SCHEDULER_HPP
+
+#include <stdint.h>
+#include <algorithm>
+#include <type_traits>
+
+#include <modm/architecture/interface/clock.hpp>
+#include "scheduler.hpp"
+
+namespace modm
+{
+
+/**
+ * Rate-monotonic scheduler for periodic tasks.
+ *
+ * Tasks are released at fixed periods and executed by calling `run()` from
+ * the main loop. When several tasks are released at the same time, the task
+ * with the shortest period runs first. Tasks are not preempted, so a running
+ * task delays higher priority tasks by at most its own execution time.
+ *
+ * The scheduler is event-driven: released tasks are taken from a min-heap
+ * ordered by release time, so that `run()` only touches tasks that are due.
+ * `run()` returns the time until the next release, which allows the caller
+ * to sleep instead of polling on every clock tick (tickless operation):
+ *
+ * ```cpp
+ * modm::PeriodicScheduler<8> scheduler;
+ * scheduler.addTask(controlTask, 1ms);
+ * scheduler.addTask(loggingTask, 100ms);
+ * while (true)
+ * {
+ *     const auto idle = scheduler.run();
+ *     sleepFor(idle); // e.g. configure a wakeup timer and __WFI()
+ * }
+ * ```
+ *
+ * For every task the scheduler records the release jitter (the delay from the
+ * release time to the start of execution), the response time and the number
+ * of missed deadlines. Releases that already passed when a task finishes are
+ * skipped and counted, so that a late task does not catch up with several
+ * back-to-back runs.
+ *
+ * Time is compared with wrap-around arithmetic, therefore all periods and
+ * deadlines must be shorter than half the clock range.
+ *
+ * @tparam	Capacity	maximum number of tasks
+ * @tparam	Clock		`modm::chrono::milli_clock` or `modm::chrono::micro_clock`
+ *
+ * @ingroup	modm_processing_scheduler
+ */
+template< size_t Capacity, class Clock = modm::chrono::milli_clock >
+class PeriodicScheduler
+{
+	static_assert(Capacity > 0, "PeriodicScheduler must hold at least one task!");
+	static_assert(Capacity < 0xffff, "PeriodicScheduler can hold at most 65534 tasks!");
+
+public:
+	using Task = Scheduler::Task;
+	using duration = typename Clock::duration;
+	using time_point = typename Clock::time_point;
+	using Index = std::conditional_t< (Capacity >= 255), uint16_t, uint8_t >;
+
+	/// Execution statistics of a task
+	struct Statistics
+	{
+		uint32_t releases;		///< number of times the task was executed
+		uint32_t misses;		///< number of times the task finished after its deadline
+		uint32_t skips;			///< number of releases skipped, because the task was late
+		duration maxJitter;		///< longest delay between release and start of execution
+		duration maxResponse;	///< longest time between release and end of execution
+	};
+
+public:
+	PeriodicScheduler() = default;
+
+	/**
+	 * Adds a task that is released every period.
+	 *
+	 * @param	period		time between releases, must be non-zero
+	 * @param	deadline	maximum time from release to the end of execution,
+	 *						zero uses the period as deadline
+	 * @param	offset		time from now until the first release
+	 *
+	 * @return	`false` if the scheduler is full or the task was already added
+	 */
+	bool
+	addTask(Task& task, duration period, duration deadline = duration::zero(),
+			duration offset = duration::zero())
+	{
+		if (period == duration::zero() or find(task) != Invalid) return false;
+		for (Index slot = 0; slot < Capacity; ++slot)
+		{
+			Entry& entry = entries[slot];
+			if (entry.state != State::Free) continue;
+			entry.task = &task;
+			entry.period = period;
+			entry.deadline = (deadline == duration::zero()) ? period : deadline;
+			entry.release = Clock::now() + offset;
+			entry.statistics = {};
+			push(waiting, waitingSize, slot, &PeriodicScheduler::releasedBefore);
+			entry.state = State::Waiting;
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Removes a task from the scheduler.
+	 * A task may remove itself or other tasks while it is running.
+	 *
+	 * @return	`false` if the task was not found
+	 */
+	bool
+	removeTask(const Task& task)
+	{
+		const Index slot = find(task);
+		if (slot == Invalid) return false;
+		Entry& entry = entries[slot];
+		if (entry.state == State::Waiting)
+			remove(waiting, waitingSize, entry.position, &PeriodicScheduler::releasedBefore);
+		else if (entry.state == State::Ready)
+			remove(ready, readySize, entry.position, &PeriodicScheduler::higherPriority);
+		// a running task is not rescheduled once it returns
+		entry.state = State::Free;
+		entry.task = nullptr;
+		return true;
+	}
+
+	bool
+	containsTask(const Task& task) const
+	{ return find(task) != Invalid; }
+
+	/// @return number of scheduled tasks
+	size_t
+	getSize() const
+	{
+		return std::count_if(std::begin(entries), std::end(entries),
+				[](const Entry& entry) { return entry.task; });
+	}
+
+	static constexpr size_t
+	getCapacity()
+	{ return Capacity; }
+
+	/**
+	 * Executes all released tasks in priority order until no task is due.
+	 * Tasks released while another task is running are considered before
+	 * the next task is chosen.
+	 *
+	 * @return	time until the next release or `duration::max()` if there are
+	 *			no tasks.
+	 */
+	duration
+	run()
+	{
+		while (true)
+		{
+			const time_point now = Clock::now();
+			while (waitingSize and not isBefore(now, entries[waiting[0]].release))
+			{
+				const Index slot = remove(waiting, waitingSize, 0, &PeriodicScheduler::releasedBefore);
+				push(ready, readySize, slot, &PeriodicScheduler::higherPriority);
+				entries[slot].state = State::Ready;
+			}
+			if (readySize == 0) break;
+
+			const Index slot = remove(ready, readySize, 0, &PeriodicScheduler::higherPriority);
+			Entry& entry = entries[slot];
+			entry.state = State::Running;
+			entry.statistics.releases++;
+			entry.statistics.maxJitter = std::max(entry.statistics.maxJitter, duration(now - entry.release));
+
+			entry.task->run();
+
+			if (entry.state != State::Running) continue;
+			const time_point finish = Clock::now();
+			const duration response = finish - entry.release;
+			entry.statistics.maxResponse = std::max(entry.statistics.maxResponse, response);
+			if (response > entry.deadline) entry.statistics.misses++;
+
+			// keep the phase, but skip all releases that are already past
+			entry.release += entry.period;
+			while (not isBefore(finish, entry.release))
+			{
+				entry.release += entry.period;
+				entry.statistics.skips++;
+			}
+			push(waiting, waitingSize, slot, &PeriodicScheduler::releasedBefore);
+			entry.state = State::Waiting;
+		}
+		return getTimeUntilNextRelease();
+	}
+
+	/// @return	time until the next release, zero if a release is due or
+	///			`duration::max()` if there are no tasks.
+	duration
+	getTimeUntilNextRelease() const
+	{
+		if (readySize) return duration::zero();
+		if (not waitingSize) return duration::max();
+		const time_point now = Clock::now();
+		const time_point release = entries[waiting[0]].release;
+		return isBefore(now, release) ? duration(release - now) : duration::zero();
+	}
+
+	/// @return	statistics of the task or `nullptr` if the task was not found
+	const Statistics*
+	getStatistics(const Task& task) const
+	{
+		const Index slot = find(task);
+		return (slot == Invalid) ? nullptr : &entries[slot].statistics;
+	}
+
+	/// Clears the statistics of all tasks
+	void
+	resetStatistics()
+	{
+		for (Entry& entry : entries) entry.statistics = {};
+	}
+
+private:
+	static constexpr Index Invalid = Index(-1);
+
+	enum class
+	State : uint8_t
+	{
+		Free,
+		Waiting,
+		Ready,
+		Running,
+	};
+
+	struct Entry
+	{
+		Task* task{nullptr};
+		duration period{};
+		duration deadline{};
+		time_point release{};
+		Statistics statistics{};
+		Index position{0};	///< index in the waiting or ready heap
+		State state{State::Free};
+	};
+
+	using Less = bool (PeriodicScheduler::*)(Index, Index) const;
+
+	/// @return `true` if a is before b, correct across clock overflow
+	static bool
+	isBefore(time_point a, time_point b)
+	{
+		return std::make_signed_t<typename duration::rep>((a - b).count()) < 0;
+	}
+
+	bool
+	releasedBefore(Index a, Index b) const
+	{
+		if (entries[a].release != entries[b].release)
+			return isBefore(entries[a].release, entries[b].release);
+		return higherPriority(a, b);
+	}
+
+	bool
+	higherPriority(Index a, Index b) const
+	{
+		if (entries[a].period != entries[b].period)
+			return entries[a].period < entries[b].period;
+		return a < b;
+	}
+
+	Index
+	find(const Task& task) const
+	{
+		for (Index slot = 0; slot < Capacity; ++slot)
+			if (entries[slot].task == &task) return slot;
+		return Invalid;
+	}
+
+	void
+	place(Index* heap, Index position, Index slot)
+	{
+		heap[position] = slot;
+		entries[slot].position = position;
+	}
+
+	void
+	siftUp(Index* heap, Index position, Less less)
+	{
+		const Index slot = heap[position];
+		while (position > 0)
+		{
+			const Index parent = (position - 1) / 2;
+			if (not (this->*less)(slot, heap[parent])) break;
+			place(heap, position, heap[parent]);
+			position = parent;
+		}
+		place(heap, position, slot);
+	}
+
+	void
+	siftDown(Index* heap, Index size, Index position, Less less)
+	{
+		const Index slot = heap[position];
+		while (true)
+		{
+			size_t child = 2 * size_t(position) + 1;
+			if (child >= size) break;
+			if (child + 1 < size and (this->*less)(heap[child + 1], heap[child])) child++;
+			if (not (this->*less)(heap[child], slot)) break;
+			place(heap, position, heap[child]);
+			position = child;
+		}
+		place(heap, position, slot);
+	}
+
+	void
+	push(Index* heap, Index& size, Index slot, Less less)
+	{
+		place(heap, size, slot);
+		siftUp(heap, size++, less);
+	}
+
+	Index
+	remove(Index* heap, Index& size, Index position, Less less)
+	{
+		const Index slot = heap[position];
+		if (position < --size)
+		{
+			// the last element may need to move in either direction
+			const Index last = heap[size];
+			place(heap, position, last);
+			siftDown(heap, size, position, less);
+			siftUp(heap, entries[last].position, less);
+		}
+		return slot;
+	}
+
+	Entry entries[Capacity];
+	Index waiting[Capacity];
+	Index ready[Capacity];
+	Index waitingSize{0};
+	Index readySize{0};
+};
+
+} // namespace modm
+
+#endif // MODM_PERIODIC_SCHEDULER_HPP
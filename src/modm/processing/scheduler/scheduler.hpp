@@ -33,6 +33,7 @@ namespace modm
 	 * task with a higher priority becomes ready or the current task ends.
 	 *
 	 * \warning	Works for ATmega, but currently not for the ATxmega!
+	 * \see		PeriodicScheduler for a tickless scheduler with task removal
 	 *
 	 * \author	Fabian Greif
 	 * \todo	Check that this implementation works from inside an interrupt
@@ -14,3 +14,4 @@
 #include "timer/timestamp.hpp"
 #include "timer/timeout.hpp"
 #include "timer/periodic_timer.hpp"
+#include "timer/timer_queue.hpp"
@@ -19,6 +19,9 @@
 #include <modm/math/utils/arithmetic_traits.hpp>
 #include <modm/architecture/interface/clock.hpp>
 #include <modm/architecture/interface/assert.hpp>
+#if __has_include(<modm/platform/core/virtual_time.hpp>)
+#include <modm/platform/core/virtual_time.hpp>
+#endif
 
 namespace modm
 {
@@ -131,7 +131,16 @@ template< class Clock, class Duration >
 bool
 modm::GenericTimeout<Clock, Duration>::checkExpiration() const
 {
+#ifdef MODM_HAS_VIRTUAL_TIME
+	if (not (_state & ARMED)) return false;
+	const duration elapsed = now() - _start;
+	if (elapsed >= _interval) return true;
+	// let the virtual time advance to the expiration
+	modm::platform::VirtualTime::wakeup(_interval - elapsed);
+	return false;
+#else
 	return (_state & ARMED) and (now() - _start) >= _interval;
+#endif
 }
 
 template< class Clock, class Duration >
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <modm/architecture/interface/assert.hpp>
+#include <modm/architecture/interface/atomic_lock.hpp>
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/utils/inplace_function.hpp>
+#include <type_traits>
+#if __has_include(<modm/platform/core/virtual_time.hpp>)
+#include <modm/platform/core/virtual_time.hpp>
+#endif
+
+namespace modm
+{
+
+/**
+ * Multiplexes many software timers onto a single clock deadline.
+ *
+ * Armed timers are kept in a list sorted by deadline, so that `update()` only
+ * reads the clock once and compares it with the earliest deadline, instead of
+ * every timer polling the clock on its own. On expiry, the timer's callback is
+ * invoked from `update()` and its expired flag is set, which a fiber or
+ * protothread can wait on without reading the clock.
+ *
+ * Whenever the earliest deadline changes, the optional alarm function is
+ * called with the new deadline, so that it can program a single hardware
+ * timer compare or the SysTick reload, whose interrupt then calls `update()`.
+ * Alternatively, call `update()` from the main loop and use
+ * `getTimeUntilNextDeadline()` to sleep until the next deadline.
+ *
+ * ```cpp
+ * modm::TimerQueue<> queue;
+ * modm::TimerQueue<>::Timer blink([]{ Board::LedGreen::toggle(); });
+ * modm::TimerQueue<>::Timer timeout;
+ *
+ * queue.startPeriodic(blink, 500ms);
+ * queue.start(timeout, 100ms);
+ * while (true)
+ * {
+ *     queue.update();
+ *     if (timeout.isExpired()) { ... }
+ * }
+ * ```
+ *
+ * Inserting a timer is linear in the number of timers with an earlier
+ * deadline, cancelling a timer and checking for expiration is constant time.
+ * The list is protected by an atomic lock, so timers may be started and
+ * cancelled from the main loop while `update()` is called from an interrupt.
+ * Callbacks are invoked outside of the lock.
+ *
+ * A timer is marked as running while `update()` invokes its callback.
+ * Cancelling a running timer is allowed, also from within the callback, and
+ * prevents its next period.
+ *
+ * @warning	A timer must not be destroyed while its callback is running, not
+ *			even from within its own callback. Only destroy timers from the
+ *			context that calls `update()` and outside of their callbacks.
+ *
+ * Time is compared with wrap-around arithmetic, therefore all delays must be
+ * shorter than half the clock range.
+ *
+ * @tparam	Clock	`modm::chrono::milli_clock` or `modm::chrono::micro_clock`
+ *
+ * @ingroup	modm_processing_timer
+ */
+template< class Clock = modm::chrono::milli_clock >
+class TimerQueue
+{
+	TimerQueue(const TimerQueue&) = delete;
+	TimerQueue& operator=(const TimerQueue&) = delete;
+
+public:
+	using duration = typename Clock::duration;
+	using time_point = typename Clock::time_point;
+	using Callback = modm::inplace_function<void()>;
+	using Alarm = modm::inplace_function<void(time_point)>;
+
+	/// A timer that is owned by the caller and linked into the queue while armed.
+	class Timer
+	{
+		friend class TimerQueue;
+		Timer(const Timer&) = delete;
+		Timer& operator=(const Timer&) = delete;
+
+	public:
+		Timer() = default;
+
+		explicit Timer(Callback&& callback) :
+			callback(std::move(callback)) {}
+
+		/// Removes the timer from the queue
+		~Timer()
+		{
+			modm_assert(not running, "tmrq.run",
+					"Timer destroyed while its callback is running!", uintptr_t(this));
+			if (queue) queue->cancel(*this);
+		}
+
+		void
+		setCallback(Callback&& callback)
+		{ this->callback = std::move(callback); }
+
+		/// @return `true` if the timer is waiting for its deadline
+		bool
+		isArmed() const
+		{ return queue; }
+
+		/// @return `true` if the timer expired at least once since it was started
+		bool
+		isExpired() const
+		{ return expired; }
+
+		/// @return `true` while `update()` invokes the callback of this timer
+		bool
+		isRunning() const
+		{ return running; }
+
+		/// @return the next deadline, only valid while armed
+		time_point
+		getDeadline() const
+		{ return deadline; }
+
+	private:
+		Timer* next{nullptr};
+		Timer* prev{nullptr};
+		TimerQueue* queue{nullptr};
+		time_point deadline{};
+		duration period{};
+		Callback callback;
+		volatile bool expired{false};
+		volatile bool running{false};
+	};
+
+public:
+	/// @param	alarm	called with the new earliest deadline whenever it changes.
+	///					If the deadline has already passed, trigger immediately.
+	explicit TimerQueue(Alarm&& alarm = {}) :
+		alarm(std::move(alarm)) {}
+
+	~TimerQueue()
+	{
+		while (head) cancel(*head);
+	}
+
+	/// Arms the timer to expire once after the delay, restarting it if armed.
+	void
+	start(Timer& timer, duration delay)
+	{
+		arm(timer, Clock::now() + delay, duration::zero());
+	}
+
+	/// Arms the timer to expire after every period, restarting it if armed.
+	void
+	startPeriodic(Timer& timer, duration period)
+	{
+		arm(timer, Clock::now() + period, period);
+	}
+
+	/// @return `false` if the timer was not armed
+	bool
+	cancel(Timer& timer)
+	{
+		bool changed;
+		{
+			atomic::Lock lock;
+			if (timer.queue != this) return false;
+			changed = (&timer == head);
+			unlink(timer);
+		}
+		if (changed) notify();
+		return true;
+	}
+
+	/**
+	 * Invokes the callbacks of all expired timers and rearms periodic timers.
+	 * Periodic timers keep their phase, but skip all periods that have
+	 * already passed, so that callbacks are not invoked back-to-back.
+	 *
+	 * @return number of expired timers
+	 */
+	size_t
+	update()
+	{
+		size_t count{0};
+		bool changed{false};
+		const time_point now = Clock::now();
+		while (true)
+		{
+			Timer* timer;
+			{
+				atomic::Lock lock;
+				timer = head;
+				if (timer == nullptr or isBefore(now, timer->deadline)) break;
+				unlink(*timer);
+				if (timer->period != duration::zero())
+				{
+					do timer->deadline += timer->period;
+					while (not isBefore(now, timer->deadline));
+					insert(*timer);
+				}
+				timer->expired = true;
+				// the timer must stay alive until the callback returns
+				timer->running = true;
+				changed = true;
+			}
+			count++;
+			if (timer->callback) timer->callback();
+			{
+				atomic::Lock lock;
+				timer->running = false;
+			}
+		}
+		if (changed) notify();
+#ifdef MODM_HAS_VIRTUAL_TIME
+		time_point deadline;
+		{
+			atomic::Lock lock;
+			if (head == nullptr or not isBefore(now, head->deadline)) return count;
+			deadline = head->deadline;
+		}
+		modm::platform::VirtualTime::wakeup(deadline - now);
+#endif
+		return count;
+	}
+
+	/// @return `true` if no timer is armed
+	bool
+	isEmpty() const
+	{ return head == nullptr; }
+
+	/// @return the earliest deadline, only valid if not empty
+	time_point
+	getNextDeadline() const
+	{
+		atomic::Lock lock;
+		return head->deadline;
+	}
+
+	/// @return time until the earliest deadline, zero if it has passed, or
+	///			`duration::max()` if no timer is armed.
+	duration
+	getTimeUntilNextDeadline() const
+	{
+		atomic::Lock lock;
+		if (head == nullptr) return duration::max();
+		const time_point now = Clock::now();
+		return isBefore(now, head->deadline) ? duration(head->deadline - now) : duration::zero();
+	}
+
+private:
+	/// @return `true` if a is before b, correct across clock overflow
+	static bool
+	isBefore(time_point a, time_point b)
+	{
+		return std::make_signed_t<typename duration::rep>((a - b).count()) < 0;
+	}
+
+	void
+	arm(Timer& timer, time_point deadline, duration period)
+	{
+		{
+			atomic::Lock lock;
+			if (timer.queue) timer.queue->unlink(timer);
+			timer.deadline = deadline;
+			timer.period = period;
+			timer.expired = false;
+			insert(timer);
+		}
+		notify();
+	}
+
+	/// Inserts after all timers with an earlier or equal deadline
+	void
+	insert(Timer& timer)
+	{
+		Timer* prev{nullptr};
+		Timer* next = head;
+		while (next and not isBefore(timer.deadline, next->deadline))
+		{
+			prev = next;
+			next = next->next;
+		}
+		timer.prev = prev;
+		timer.next = next;
+		if (next) next->prev = &timer;
+		if (prev) prev->next = &timer;
+		else head = &timer;
+		timer.queue = this;
+	}
+
+	void
+	unlink(Timer& timer)
+	{
+		if (timer.prev) timer.prev->next = timer.next;
+		else head = timer.next;
+		if (timer.next) timer.next->prev = timer.prev;
+		timer.next = timer.prev = nullptr;
+		timer.queue = nullptr;
+	}
+
+	void
+	notify()
+	{
+		if (not alarm) return;
+		time_point deadline;
+		{
+			atomic::Lock lock;
+			if (head == nullptr)
+			{
+				alarmArmed = false;
+				return;
+			}
+			deadline = head->deadline;
+			if (alarmArmed and deadline == alarmDeadline) return;
+			alarmDeadline = deadline;
+			alarmArmed = true;
+		}
+		alarm(deadline);
+	}
+
+	Timer* head{nullptr};
+	Alarm alarm;
+	time_point alarmDeadline{};
+	bool alarmArmed{false};
+};
+
+} // namespace modm
@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2014, Daniel Krebs
  * Copyright (c) 2014, Sascha Schade
- * Copyright (c) 2014-2015, 2018, Niklas Hauser
+ * Copyright (c) 2014-2015, 2018, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -20,6 +20,7 @@
 #include <modm/container/queue.hpp>
 #include <modm/container/doubly_linked_list.hpp>
 #include <modm/processing/timer.hpp>
+#include <modm/utils/inplace_function.hpp>
 
 #include <modm/debug/logger.hpp>
 
@@ -28,6 +29,12 @@
 #define NULL 0
 #endif
 
+#if defined __DOXYGEN__ || !defined MODM_GUI_CALLBACK_STORAGE
+/// Storage size of the GUI callbacks in bytes
+/// @ingroup modm_ui_gui
+#define MODM_GUI_CALLBACK_STORAGE sizeof(void*)
+#endif
+
 namespace modm
 {
 
@@ -42,8 +49,9 @@ class Widget;
 /// Container used in view to store widgets
 /// @ingroup modm_ui_gui
 typedef modm::DynamicArray<Widget*> WidgetContainer;
+/// Callback without heap allocation, see `MODM_GUI_CALLBACK_STORAGE`
 /// @ingroup modm_ui_gui
-typedef void (*genericCallback)(void*);
+typedef modm::inplace_function<void(void*), MODM_GUI_CALLBACK_STORAGE, alignof(void*)> genericCallback;
 
 /**
  * Input event that is collected when some input happens. Will be processed by View
@@ -132,9 +140,9 @@ typedef modm::DoublyLinkedList<AsyncEvent*> AsyncEventList;
 /// @ingroup modm_ui_gui
 typedef modm::Queue<InputEvent*, modm::LinkedList<InputEvent*> > inputQueue;
 
-/// Callback when an event happend
+/// Callback when an event happend, see `MODM_GUI_CALLBACK_STORAGE`
 /// @ingroup modm_ui_gui
-typedef void (*eventCallback)(const InputEvent&, Widget*, void*);
+typedef modm::inplace_function<void(const InputEvent&, Widget*, void*), MODM_GUI_CALLBACK_STORAGE, alignof(void*)> eventCallback;
 /// @ingroup modm_ui_gui
 typedef struct Dimension
 {
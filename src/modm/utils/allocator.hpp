@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2010, Fabian Greif
- * Copyright (c) 2011-2012, Niklas Hauser
+ * Copyright (c) 2011-2012, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -13,8 +13,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <new>      // needed for placement new
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <modm/architecture/interface/assert.hpp>
+#include <modm/architecture/interface/atomic_lock.hpp>
 
 namespace modm::allocator
 {
@@ -33,17 +40,19 @@ public:
      * Construct an object
      *
      * Constructs an object of type T (the template parameter) on the
-     * location pointed by p using its copy constructor to initialize
-     * its value to \p value.
+     * location pointed by p, forwarding the arguments to its constructor.
+     * With a single argument of type T, this is the copy or move
+     * constructor.
      *
      * Notice that this does not allocate space for the element, it
      * should already be available at p.
      */
+    template <typename... Args>
     static inline void
-    construct(T* p, const T& value)
+    construct(T* p, Args&&... args)
     {
         // placement new
-        ::new((void *) p) T(value);
+        ::new((void *) p) T(std::forward<Args>(args)...);
     }
 
     /**
@@ -120,4 +129,335 @@ public:
     }
 };
 
+/// Usage statistics of a memory pool
+/// @ingroup modm_utils
+struct PoolStatistics
+{
+    std::size_t used;       ///< number of allocated blocks
+    std::size_t peak;       ///< maximum number of allocated blocks
+    std::size_t failures;   ///< number of failed allocations
+};
+
+/**
+ * Pool of fixed-size memory blocks
+ *
+ * Free blocks are kept in a singly-linked list stored inside the blocks
+ * themselves, so allocating and deallocating is O(1) without any memory
+ * overhead per block. Blocks that have never been allocated are taken from
+ * the end of the storage, so the pool does not need to be initialized and
+ * can be placed in zero-initialized memory.
+ *
+ * @tparam  BlockSize       size of each block in bytes
+ * @tparam  Blocks          number of blocks
+ * @tparam  Alignment       alignment of each block
+ * @tparam  InterruptSafe   protect the free list with a `modm::atomic::Lock`,
+ *                          so that the pool can be used from interrupts.
+ *
+ * @ingroup modm_utils
+ */
+template <std::size_t BlockSize, std::size_t Blocks,
+          std::size_t Alignment = alignof(std::max_align_t), bool InterruptSafe = false>
+class MemoryPool
+{
+    static_assert(Blocks > 0, "MemoryPool must contain at least one block!");
+
+public:
+    static constexpr std::size_t Size = BlockSize;
+
+    constexpr MemoryPool() = default;
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    /// @return a block or `nullptr` if all blocks are allocated
+    void*
+    allocate()
+    {
+        Lock lock;
+        Block* block = free;
+        if (block) {
+            free = block->next;
+        } else if (initialized < Blocks) {
+            block = &blocks[initialized++];
+        } else {
+            statistics.failures++;
+            return nullptr;
+        }
+        if (++statistics.used > statistics.peak) {
+            statistics.peak = statistics.used;
+        }
+        return block;
+    }
+
+    /// Returns a block previously allocated from this pool
+    void
+    deallocate(void* p)
+    {
+        Lock lock;
+        Block* block = static_cast<Block*>(p);
+        block->next = free;
+        free = block;
+        statistics.used--;
+    }
+
+    /// @return `true` if the pointer is inside the storage of this pool
+    bool
+    owns(const void* p) const
+    {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(p);
+        return address >= reinterpret_cast<uintptr_t>(blocks) and
+               address < reinterpret_cast<uintptr_t>(blocks + Blocks);
+    }
+
+    /// @return number of blocks that can still be allocated
+    std::size_t
+    getAvailable() const
+    {
+        return Blocks - statistics.used;
+    }
+
+    static constexpr std::size_t
+    getCapacity()
+    {
+        return Blocks;
+    }
+
+    const PoolStatistics&
+    getStatistics() const
+    {
+        return statistics;
+    }
+
+    /// Clears the peak usage and the failure count
+    void
+    resetStatistics()
+    {
+        Lock lock;
+        statistics.peak = statistics.used;
+        statistics.failures = 0;
+    }
+
+private:
+    struct Unlocked {};
+    using Lock = std::conditional_t<InterruptSafe, modm::atomic::Lock, Unlocked>;
+
+    union Block
+    {
+        Block* next;
+        alignas(Alignment) std::byte data[BlockSize];
+    };
+
+    Block blocks[Blocks]{};
+    Block* free{nullptr};
+    std::size_t initialized{0};
+    PoolStatistics statistics{};
+};
+
+/**
+ * Object pool allocator
+ *
+ * Allocates single objects from a pool of `N` blocks with O(1) allocate and
+ * deallocate. All allocators of the same type share one pool, which is
+ * statically allocated. When rebound by a container, each node type gets its
+ * own pool of `N` nodes:
+ *
+ * ```cpp
+ * // up to 32 elements in all lists of this type together
+ * modm::LinkedList<Message, modm::allocator::Pool<Message, 32>> list;
+ * ```
+ *
+ * Since the pool can only allocate single objects, use `SizeClass` for
+ * `modm::DynamicArray`. An exhausted pool returns `nullptr` and fails the
+ * `pool` assertion in debug mode.
+ *
+ * @tparam  T               type of the allocated objects
+ * @tparam  N               number of objects in the pool
+ * @tparam  InterruptSafe   use the pool from interrupts as well
+ *
+ * @ingroup modm_utils
+ */
+template <typename T, std::size_t N, bool InterruptSafe = false>
+class Pool : public AllocatorBase<T>
+{
+public:
+    template <typename U>
+    struct rebind
+    {
+        typedef Pool<U, N, InterruptSafe> other;
+    };
+
+    using Storage = MemoryPool<sizeof(T), N, alignof(T), InterruptSafe>;
+
+public:
+    Pool() :
+        AllocatorBase<T>()
+    {
+    }
+
+    Pool(const Pool& other) :
+        AllocatorBase<T>(other)
+    {
+    }
+
+    template <typename U>
+    Pool(const Pool<U, N, InterruptSafe>&) :
+        AllocatorBase<T>()
+    {
+    }
+
+    T*
+    allocate(size_t n)
+    {
+        void* p = (n == 1) ? storage.allocate() : nullptr;
+        modm_assert_continue_fail_debug(p, "pool",
+                "Pool allocator is exhausted or cannot allocate arrays!", n);
+        return static_cast<T*>(p);
+    }
+
+    void
+    deallocate(T* p)
+    {
+        if (p) storage.deallocate(p);
+    }
+
+    /// @return the pool shared by all allocators of this type
+    static Storage&
+    getStorage()
+    {
+        return storage;
+    }
+
+private:
+    static inline constinit Storage storage;
+};
+
+/**
+ * Pool of memory blocks in several size classes
+ *
+ * Contains `Blocks` blocks of each of the sizes, which must be given in
+ * ascending order. A request is served from the smallest size class that
+ * fits and has a free block left, so small requests can fall back to larger
+ * blocks. All operations are O(1) in the number of blocks.
+ *
+ * The pool is shared by all types allocated through `allocator::SizeClass`,
+ * so it is always protected with a `modm::atomic::Lock`.
+ *
+ * ```cpp
+ * modm::allocator::SizeClassPool<8, 32, 128, 512> pool;
+ * modm::DynamicArray<int, modm::allocator::SizeClass<int, pool>> array;
+ * ```
+ *
+ * @ingroup modm_utils
+ */
+template <std::size_t Blocks, std::size_t... Sizes>
+class SizeClassPool
+{
+    static_assert(sizeof...(Sizes) > 0, "SizeClassPool requires at least one size class!");
+    static_assert(std::ranges::is_sorted(std::initializer_list<std::size_t>{Sizes...}),
+                  "SizeClassPool sizes must be in ascending order!");
+
+public:
+    static constexpr std::size_t Classes = sizeof...(Sizes);
+    static constexpr std::size_t MaxSize = std::max({Sizes...});
+
+    constexpr SizeClassPool() = default;
+    SizeClassPool(const SizeClassPool&) = delete;
+    SizeClassPool& operator=(const SizeClassPool&) = delete;
+
+    /// @return a block of at least `size` bytes or `nullptr`
+    void*
+    allocate(std::size_t size)
+    {
+        void* p{nullptr};
+        std::apply([&](auto&... pool)
+        {
+            ((p = (not p and size <= pool.Size) ? pool.allocate() : p), ...);
+        }, pools);
+        return p;
+    }
+
+    /// Returns a block to the size class it was allocated from
+    void
+    deallocate(void* p)
+    {
+        std::apply([&](auto&... pool)
+        {
+            ((pool.owns(p) ? (pool.deallocate(p), true) : false) or ...);
+        }, pools);
+    }
+
+    /// @return statistics of the size class at the index
+    const PoolStatistics&
+    getStatistics(std::size_t index) const
+    {
+        const PoolStatistics* statistics{nullptr};
+        std::size_t ii{0};
+        std::apply([&](const auto&... pool)
+        {
+            ((ii++ == index ? (statistics = &pool.getStatistics(), true) : false) or ...);
+        }, pools);
+        return *statistics;
+    }
+
+private:
+    std::tuple<MemoryPool<Sizes, Blocks, alignof(std::max_align_t), true>...> pools;
+};
+
+/**
+ * Size class allocator
+ *
+ * Allocates objects and arrays of any type from a shared `SizeClassPool`.
+ * The allocator keeps the reference to the pool when it is rebound, so it
+ * can be used by all containers, including `modm::DynamicArray`.
+ * An exhausted pool returns `nullptr` and fails the `pool` assertion in
+ * debug mode.
+ *
+ * @tparam  T       type of the allocated objects
+ * @tparam  pool    `SizeClassPool` with static storage duration
+ *
+ * @ingroup modm_utils
+ */
+template <typename T, auto& pool>
+class SizeClass : public AllocatorBase<T>
+{
+public:
+    template <typename U>
+    struct rebind
+    {
+        typedef SizeClass<U, pool> other;
+    };
+
+public:
+    SizeClass() :
+        AllocatorBase<T>()
+    {
+    }
+
+    SizeClass(const SizeClass& other) :
+        AllocatorBase<T>(other)
+    {
+    }
+
+    template <typename U>
+    SizeClass(const SizeClass<U, pool>&) :
+        AllocatorBase<T>()
+    {
+    }
+
+    T*
+    allocate(size_t n)
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t));
+        void* p = pool.allocate(n * sizeof(T));
+        modm_assert_continue_fail_debug(p, "pool",
+                "Size class pool is exhausted!", n * sizeof(T));
+        return static_cast<T*>(p);
+    }
+
+    void
+    deallocate(T* p)
+    {
+        if (p) pool.deallocate(p);
+    }
+};
+
 }
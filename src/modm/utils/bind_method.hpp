@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace modm
+{
+
+/**
+ * Binds a member function to an object without allocating memory.
+ *
+ * The member function is passed as a template argument, so that the returned
+ * callable only stores the object pointer and fits into the default storage of
+ * `modm::inplace_function`. Calling it costs one indirect call through the
+ * `inplace_function`, which then calls the member function directly.
+ *
+ * @code
+ * struct Display { void onButton(uint8_t line); } display;
+ *
+ * Exti::connect<Button>(Exti::Trigger::FallingEdge,
+ *                       modm::bind_method<&Display::onButton>(&display));
+ * @endcode
+ *
+ * @ingroup modm_utils
+ */
+template< auto Method, class Object >
+constexpr auto
+bind_method(Object *object)
+{
+	static_assert(std::is_member_function_pointer_v<decltype(Method)>,
+				  "bind_method requires a pointer to a member function!");
+	return [object]<class... Args>(Args&&... args) -> decltype(auto)
+	{
+		return std::invoke(Method, object, std::forward<Args>(args)...);
+	};
+}
+
+}	// namespace modm
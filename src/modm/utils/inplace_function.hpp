@@ -32,6 +32,12 @@
 #include <modm/architecture/interface/assert.hpp>
 #include <modm/utils/aligned_storage.hpp>
 
+#if defined __DOXYGEN__ || !defined MODM_INPLACE_FUNCTION_STORAGE
+/// Default storage size of `modm::inplace_function` in bytes
+/// @ingroup modm_utils
+#define MODM_INPLACE_FUNCTION_STORAGE sizeof(void*)
+#endif
+
 namespace modm
 {
 
@@ -39,7 +45,7 @@ namespace modm
 namespace inplace_function_detail
 {
 
-static constexpr size_t InplaceFunctionDefaultCapacity = sizeof(void*);
+static constexpr size_t InplaceFunctionDefaultCapacity = MODM_INPLACE_FUNCTION_STORAGE;
 
 template<class T> struct wrapper
 {
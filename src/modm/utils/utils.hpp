@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2011, Fabian Greif
- * Copyright (c) 2011-2012, 2017-2018, Niklas Hauser
+ * Copyright (c) 2011-2012, 2017-2018, 2026, Niklas Hauser
  * Copyright (c) 2014, Kevin Läufer
  *
  * This file is part of the modm project.
@@ -18,3 +18,4 @@
 #include "utils/aligned_storage.hpp"
 #include "utils/inplace_any.hpp"
 #include "utils/inplace_function.hpp"
+#include "utils/bind_method.hpp"
@@ -22,17 +22,27 @@ namespace
 	FLASH_STORAGE_STRING(failHeader) = "FAIL: ";
 	FLASH_STORAGE_STRING(failColon) = " : ";
 
+	FLASH_STORAGE_STRING(benchHeader) = "BENCH: ";
+	FLASH_STORAGE_STRING(benchIterations) = " iterations=";
+	FLASH_STORAGE_STRING(benchRepetitions) = " repetitions=";
+	FLASH_STORAGE_STRING(benchMin) = " min=";
+	FLASH_STORAGE_STRING(benchMedian) = " median=";
+	FLASH_STORAGE_STRING(benchMax) = " max=";
+	FLASH_STORAGE_STRING(benchUnit) = " unit=";
+
+	FLASH_STORAGE_STRING(reportRan) = "\nRan ";
 	FLASH_STORAGE_STRING(reportPassed) = "\nPassed ";
 	FLASH_STORAGE_STRING(reportFailed) = "\nFailed ";
 	FLASH_STORAGE_STRING(reportOf) = " of ";
 	FLASH_STORAGE_STRING(reportTests) = " tests\n";
+	FLASH_STORAGE_STRING(reportBenchmarks) = " benchmarks\n";
 	FLASH_STORAGE_STRING(reportOk) = "OK!\n";
 	FLASH_STORAGE_STRING(reportFail) = "FAIL!\n";
 }
 
 unittest::Reporter::Reporter(modm::IODevice& device) :
 	outputStream(device), testName(modm::accessor::asFlash(invaildName)),
-	testsPassed(0), testsFailed(0)
+	testsPassed(0), testsFailed(0), benchmarks(0)
 {
 }
 
@@ -61,9 +71,44 @@ unittest::Reporter::reportFailure(unsigned int lineNumber)
 	return outputStream;
 }
 
+void
+unittest::Reporter::reportBenchmark(const char* name, uint32_t iterations, uint8_t repetitions,
+									 uint64_t min, uint64_t median, uint64_t max, const char* unit)
+{
+	benchmarks++;
+	outputStream << modm::accessor::asFlash(benchHeader)
+				 << testName << ':' << name
+				 << modm::accessor::asFlash(benchIterations) << iterations
+				 << modm::accessor::asFlash(benchRepetitions) << repetitions
+				 << modm::accessor::asFlash(benchMin);
+	printPerIteration(min, iterations);
+	outputStream << modm::accessor::asFlash(benchMedian);
+	printPerIteration(median, iterations);
+	outputStream << modm::accessor::asFlash(benchMax);
+	printPerIteration(max, iterations);
+	outputStream << modm::accessor::asFlash(benchUnit) << unit << modm::endl;
+}
+
+void
+unittest::Reporter::printPerIteration(uint64_t duration, uint32_t iterations)
+{
+	// fixed point with three decimals, since float formatting is optional
+	const uint64_t integer = duration / iterations;
+	const uint16_t fraction = ((duration % iterations) * 1000) / iterations;
+	outputStream << integer << '.';
+	if (fraction < 100) outputStream << '0';
+	if (fraction < 10) outputStream << '0';
+	outputStream << fraction;
+}
+
 uint8_t
 unittest::Reporter::printSummary()
 {
+	if (benchmarks) {
+		outputStream << modm::accessor::asFlash(reportRan)
+					 << benchmarks
+					 << modm::accessor::asFlash(reportBenchmarks);
+	}
 	if (testsFailed == 0) {
 		outputStream << modm::accessor::asFlash(reportPassed)
 					 << testsPassed
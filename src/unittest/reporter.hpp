@@ -67,6 +67,23 @@ namespace unittest
 		modm::IOStream&
 		reportFailure(unsigned int lineNumber);
 
+		/**
+		 * \brief	Report the result of a benchmark
+		 *
+		 * Writes one line in the machine-readable format
+		 * `BENCH: suite:name iterations=N repetitions=R min=X median=Y max=Z unit=U`,
+		 * where the durations of all samples are normalized per iteration
+		 * with three decimal places.
+		 *
+		 * \param	min		Duration of the fastest sample of all iterations
+		 * \param	median	Duration of the median sample of all iterations
+		 * \param	max		Duration of the slowest sample of all iterations
+		 * \param	unit	Name of the time unit
+		 */
+		void
+		reportBenchmark(const char* name, uint32_t iterations, uint8_t repetitions,
+						uint64_t min, uint64_t median, uint64_t max, const char* unit);
+
 		/**
 		 * \brief	Writes a summary of all the tests
 		 *
@@ -78,11 +95,15 @@ namespace unittest
 		printSummary();
 
 	private:
+		void
+		printPerIteration(uint64_t duration, uint32_t iterations);
+
 		modm::IOStream outputStream;
 		modm::accessor::Flash<char> testName;
 
 		int_fast16_t testsPassed;
 		int_fast16_t testsFailed;
+		int_fast16_t benchmarks;
 	};
 }
 
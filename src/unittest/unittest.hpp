@@ -14,5 +14,6 @@
 #include "unittest/testsuite.hpp"
 #include "unittest/harness.hpp"
 #include "unittest/reporter.hpp"
+#include "unittest/benchmark.hpp"
 
 #include "unittest/type/count_type.hpp"
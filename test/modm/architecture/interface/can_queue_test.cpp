@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "can_queue_test.hpp"
+#include <modm/architecture/interface/can_queue.hpp>
+
+static modm::can::Message
+standard(uint32_t identifier, bool rtr = false)
+{
+	modm::can::Message message(identifier, 0);
+	message.setExtended(false);
+	message.setRemoteTransmitRequest(rtr);
+	return message;
+}
+
+static modm::can::Message
+extended(uint32_t identifier, bool rtr = false)
+{
+	modm::can::Message message(identifier, 0);
+	message.setExtended(true);
+	message.setRemoteTransmitRequest(rtr);
+	return message;
+}
+
+void
+CanQueueTest::testArbitrationKey()
+{
+	using modm::can::arbitrationKey;
+
+	TEST_ASSERT_TRUE(arbitrationKey(standard(0x100)) < arbitrationKey(standard(0x101)));
+	TEST_ASSERT_TRUE(arbitrationKey(extended(0x100)) < arbitrationKey(extended(0x101)));
+	// data frames win against remote frames
+	TEST_ASSERT_TRUE(arbitrationKey(standard(0x100)) < arbitrationKey(standard(0x100, true)));
+	TEST_ASSERT_TRUE(arbitrationKey(extended(0x100)) < arbitrationKey(extended(0x100, true)));
+	// the base identifier is compared first
+	TEST_ASSERT_TRUE(arbitrationKey(extended(0x100 << 18 | 0x3ffff)) < arbitrationKey(standard(0x101)));
+	TEST_ASSERT_TRUE(arbitrationKey(standard(0x100)) < arbitrationKey(extended(0x101 << 18)));
+	// standard frames win against extended frames with the same base identifier
+	TEST_ASSERT_TRUE(arbitrationKey(standard(0x100)) < arbitrationKey(extended(0x100 << 18)));
+	TEST_ASSERT_TRUE(arbitrationKey(standard(0x100, true)) < arbitrationKey(extended(0x100 << 18)));
+}
+
+void
+CanQueueTest::testPriorityOrder()
+{
+	modm::can::PriorityQueue<5> queue;
+
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.getMaxSize(), 5u);
+
+	TEST_ASSERT_TRUE(queue.push(standard(0x700)));
+	TEST_ASSERT_TRUE(queue.push(standard(0x300)));
+	TEST_ASSERT_TRUE(queue.push(extended(0x1000)));
+	TEST_ASSERT_TRUE(queue.push(standard(0x500)));
+	TEST_ASSERT_TRUE(queue.push(standard(0x001)));
+	TEST_ASSERT_TRUE(queue.isFull());
+	TEST_ASSERT_FALSE(queue.push(standard(0x000)));
+
+	// base identifier of the extended message is zero
+	TEST_ASSERT_EQUALS(queue.get().getIdentifier(), 0x1000u);
+	queue.pop();
+	TEST_ASSERT_EQUALS(queue.get().getIdentifier(), 0x001u);
+	queue.pop();
+
+	// a high priority message overtakes the queued messages
+	TEST_ASSERT_TRUE(queue.push(standard(0x200)));
+	TEST_ASSERT_EQUALS(queue.get().getIdentifier(), 0x200u);
+	queue.pop();
+	TEST_ASSERT_EQUALS(queue.get().getIdentifier(), 0x300u);
+	queue.pop();
+
+	// a low priority message is queued behind
+	TEST_ASSERT_TRUE(queue.push(standard(0x7ff)));
+	TEST_ASSERT_EQUALS(queue.get().getIdentifier(), 0x500u);
+	queue.pop();
+	TEST_ASSERT_EQUALS(queue.get().getIdentifier(), 0x700u);
+	queue.pop();
+	TEST_ASSERT_EQUALS(queue.get().getIdentifier(), 0x7ffu);
+	queue.pop();
+
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void
+CanQueueTest::testSameIdentifierOrder()
+{
+	modm::can::PriorityQueue<8> queue;
+
+	// fragments of one transfer must not be reordered
+	for (uint8_t ii = 0; ii < 6; ++ii)
+	{
+		modm::can::Message message = standard(0x400);
+		message.setLength(1);
+		message.data[0] = ii;
+		TEST_ASSERT_TRUE(queue.push(message));
+		if (ii == 2) {
+			TEST_ASSERT_TRUE(queue.push(standard(0x600)));
+			TEST_ASSERT_TRUE(queue.push(standard(0x100)));
+		}
+	}
+
+	TEST_ASSERT_EQUALS(queue.get().getIdentifier(), 0x100u);
+	queue.pop();
+	for (uint8_t ii = 0; ii < 6; ++ii)
+	{
+		TEST_ASSERT_EQUALS(queue.get().getIdentifier(), 0x400u);
+		TEST_ASSERT_EQUALS(queue.get().data[0], ii);
+		queue.pop();
+	}
+	TEST_ASSERT_EQUALS(queue.get().getIdentifier(), 0x600u);
+	queue.pop();
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void
+CanQueueTest::testStatistics()
+{
+	modm::can::PriorityQueue<3> queue;
+
+	modm::can::QueueStatistics statistics = queue.getStatistics();
+	TEST_ASSERT_EQUALS(statistics.size, 0u);
+	TEST_ASSERT_EQUALS(statistics.capacity, 3u);
+	TEST_ASSERT_EQUALS(statistics.maxSize, 0u);
+	TEST_ASSERT_EQUALS(statistics.overflows, 0u);
+
+	queue.push(standard(1));
+	queue.push(standard(2));
+	queue.push(standard(3));
+	queue.push(standard(4));
+	queue.push(standard(5));
+	queue.pop();
+	queue.pop();
+
+	statistics = queue.getStatistics();
+	TEST_ASSERT_EQUALS(statistics.size, 1u);
+	TEST_ASSERT_EQUALS(statistics.maxSize, 3u);
+	TEST_ASSERT_EQUALS(statistics.overflows, 2u);
+
+	queue.resetStatistics();
+	statistics = queue.getStatistics();
+	TEST_ASSERT_EQUALS(statistics.size, 1u);
+	TEST_ASSERT_EQUALS(statistics.maxSize, 1u);
+	TEST_ASSERT_EQUALS(statistics.overflows, 0u);
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_UNITTEST_CAN_QUEUE_HPP
+#define MODM_UNITTEST_CAN_QUEUE_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_architecture
+class CanQueueTest : public unittest::TestSuite
+{
+public:
+	void
+	testArbitrationKey();
+
+	void
+	testPriorityOrder();
+
+	void
+	testSameIdentifierOrder();
+
+	void
+	testStatistics();
+};
+
+#endif // MODM_UNITTEST_CAN_QUEUE_HPP
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "spi_device_test.hpp"
+
+#include <modm/architecture/interface/spi_device.hpp>
+#include <modm-test/mock/spi_master.hpp>
+#include <string>
+
+using Master = modm_test::platform::SpiMaster;
+
+namespace
+{
+
+/// Records the wire sequence as a string: '[' and ']' for the chip select
+/// and the transmitted bytes in hex.
+std::string wire;
+
+void
+flush()
+{
+	static const char hex[] = "0123456789abcdef";
+	uint8_t buffer[64];
+	const std::size_t length = Master::getTxBufferLength();
+	Master::popTxBuffer(buffer);
+	for (std::size_t ii = 0; ii < length; ++ii)
+	{
+		wire += hex[buffer[ii] >> 4];
+		wire += hex[buffer[ii] & 0xf];
+	}
+}
+
+struct Cs
+{
+	static void reset() { flush(); wire += '['; }
+	static void set() { flush(); wire += ']'; }
+};
+
+class Device : public modm::SpiDevice< Master >
+{
+public:
+	using modm::SpiDevice< Master >::runTransaction;
+	using modm::SpiDevice< Master >::acquireMaster;
+	using modm::SpiDevice< Master >::releaseMaster;
+};
+
+}
+
+void
+SpiDeviceTest::setUp()
+{
+	Master::clearBuffers();
+	wire.clear();
+}
+
+void
+SpiDeviceTest::testTransaction()
+{
+	Device device;
+	const uint8_t address = 0x8f;
+	uint8_t data[3];
+	uint8_t response[] = {0xff, 0x11, 0x22, 0x33};
+	Master::appendRxBuffer(response, sizeof(response));
+
+	const modm::Spi::Segment segments[] = {
+		{&address, nullptr, 1},
+		{nullptr, data, 3},
+	};
+	TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(device.runTransaction<Cs>(segments)), modm::rf::Stop);
+	flush();
+
+	TEST_ASSERT_TRUE(wire == "[8f000000]");
+	TEST_ASSERT_EQUALS(data[0], 0x11);
+	TEST_ASSERT_EQUALS(data[1], 0x22);
+	TEST_ASSERT_EQUALS(data[2], 0x33);
+}
+
+void
+SpiDeviceTest::testChipSelectToggle()
+{
+	Device device;
+	const uint8_t command[] = {0x06, 0x02, 0x00, 0x10, 0xaa};
+	const modm::Spi::Segment segments[] = {
+		// write enable needs its own chip select cycle
+		{command, nullptr, 1, modm::Spi::ChipSelect::Toggle, 1},
+		{command + 1, nullptr, 3},
+		{command + 4, nullptr, 1, modm::Spi::ChipSelect::Toggle},
+	};
+	RF_CALL_BLOCKING(device.runTransaction<Cs>(segments));
+	flush();
+
+	// the last segment does not toggle
+	TEST_ASSERT_TRUE(wire == "[06][020010aa]");
+
+	// the device can be reused
+	wire.clear();
+	RF_CALL_BLOCKING(device.runTransaction<Cs>({segments + 2, 1}));
+	TEST_ASSERT_TRUE(wire == "[aa]");
+}
+
+void
+SpiDeviceTest::testContention()
+{
+	Device device, other;
+	const uint8_t command[] = {0x01, 0x02};
+	const modm::Spi::Segment segments[] = {
+		{command, nullptr, 2},
+	};
+
+	TEST_ASSERT_TRUE(other.acquireMaster());
+	TEST_ASSERT_EQUALS(device.runTransaction<Cs>(segments).getState(), modm::rf::Running);
+	TEST_ASSERT_EQUALS(device.runTransaction<Cs>(segments).getState(), modm::rf::Running);
+	TEST_ASSERT_TRUE(wire == "");
+
+	TEST_ASSERT_TRUE(other.releaseMaster());
+	TEST_ASSERT_EQUALS(device.runTransaction<Cs>(segments).getState(), modm::rf::Stop);
+	TEST_ASSERT_TRUE(wire == "[0102]");
+	TEST_ASSERT_EQUALS(Master::getStatistics().maxWaiters, 1u);
+}
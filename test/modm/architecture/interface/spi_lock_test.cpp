@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "spi_lock_test.hpp"
+
+#include <modm/architecture/interface/spi_lock.hpp>
+#include <modm/architecture/interface/spi_device.hpp>
+#include <modm-test/mock/spi_master.hpp>
+#include <modm-test/mock/clock.hpp>
+#include <algorithm>
+
+using namespace std::chrono_literals;
+using test_clock = modm_test::chrono::milli_clock;
+using milli_clock = modm::chrono::milli_clock;
+
+namespace
+{
+
+template< int N, uint8_t MaxWaiters = 2 >
+class Lock : public modm::SpiLock<Lock<N, MaxWaiters>, MaxWaiters> {};
+
+int configurations{0};
+void configure() { configurations++; }
+
+/// Polls the bus like a `RF_WAIT_UNTIL(acquireMaster())` and holds it for a fixed time
+class Device : public modm::SpiDevice< modm_test::platform::SpiMaster >
+{
+public:
+	Device(std::chrono::milliseconds hold) : hold(hold) {}
+
+	void
+	update()
+	{
+		if (owner)
+		{
+			if (milli_clock::now() - start < hold) return;
+			releaseMaster();
+			owner = false;
+			transfers++;
+			// immediately request the bus again
+			waiting = milli_clock::now();
+		}
+		if (acquireMaster())
+		{
+			owner = true;
+			start = milli_clock::now();
+			maxWait = std::max(maxWait, std::chrono::milliseconds(start - waiting));
+		}
+	}
+
+	void
+	reset()
+	{
+		if (owner) releaseMaster();
+		else modm_test::platform::SpiMaster::cancel(this);
+		owner = false;
+		waiting = milli_clock::now();
+	}
+
+	std::chrono::milliseconds hold;
+	std::chrono::milliseconds maxWait{};
+	milli_clock::time_point start{};
+	milli_clock::time_point waiting{};
+	uint32_t transfers{0};
+	bool owner{false};
+};
+
+}
+
+void
+SpiLockTest::testNesting()
+{
+	using L = Lock<0>;
+	int a, b;
+	configurations = 0;
+	TEST_ASSERT_EQUALS(L::acquire(&a, configure), 1u);
+	TEST_ASSERT_EQUALS(L::acquire(&a, configure), 2u);
+	TEST_ASSERT_EQUALS(configurations, 1);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 0u);
+	// releasing another context does nothing
+	TEST_ASSERT_EQUALS(L::release(&b), 2u);
+	TEST_ASSERT_EQUALS(L::release(&a), 1u);
+	TEST_ASSERT_EQUALS(L::release(&a), 0u);
+	TEST_ASSERT_EQUALS(L::getStatistics().acquisitions, 1u);
+	TEST_ASSERT_EQUALS(L::getStatistics().contentions, 1u);
+	TEST_ASSERT_EQUALS(L::getStatistics().maxHold, 1u);
+	// the lock was reserved for b
+	TEST_ASSERT_EQUALS(L::acquire(&a), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 1u);
+	TEST_ASSERT_EQUALS(L::release(&b), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&a), 1u);
+	TEST_ASSERT_EQUALS(L::release(&a), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 1u);
+	TEST_ASSERT_EQUALS(L::release(&b), 0u);
+	TEST_ASSERT_EQUALS(L::getWaiters(), 0u);
+}
+
+void
+SpiLockTest::testHandOff()
+{
+	using L = Lock<1>;
+	int a, b, c;
+	TEST_ASSERT_EQUALS(L::acquire(&a), 1u);
+	// c asks before b, but b is queued first
+	TEST_ASSERT_EQUALS(L::acquire(&b), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&c), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 0u);
+	TEST_ASSERT_EQUALS(L::getWaiters(), 2u);
+
+	TEST_ASSERT_EQUALS(L::release(&a), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&a), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&c), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 1u);
+	TEST_ASSERT_EQUALS(L::release(&b), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&c), 1u);
+	TEST_ASSERT_EQUALS(L::release(&c), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&a), 1u);
+	TEST_ASSERT_EQUALS(L::release(&a), 0u);
+
+	TEST_ASSERT_EQUALS(L::getStatistics().handOffs, 3u);
+	TEST_ASSERT_EQUALS(L::getStatistics().maxWaiters, 2u);
+	TEST_ASSERT_EQUALS(L::getStatistics().expirations, 0u);
+}
+
+void
+SpiLockTest::testQueueFull()
+{
+	using L = Lock<2>;
+	int a, b, c, d;
+	TEST_ASSERT_EQUALS(L::acquire(&a), 1u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&c), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&d), 0u);
+	TEST_ASSERT_EQUALS(L::getWaiters(), 2u);
+
+	TEST_ASSERT_EQUALS(L::release(&a), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&d), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 1u);
+	TEST_ASSERT_EQUALS(L::release(&b), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&c), 1u);
+	TEST_ASSERT_EQUALS(L::release(&c), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&d), 1u);
+	TEST_ASSERT_EQUALS(L::release(&d), 0u);
+}
+
+void
+SpiLockTest::testExpiration()
+{
+	using L = Lock<3>;
+	int a, b, c;
+	TEST_ASSERT_EQUALS(L::acquire(&a), 1u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 0u);
+	TEST_ASSERT_EQUALS(L::release(&a), 0u);
+
+	// b does not claim the lock within one pass of c
+	TEST_ASSERT_EQUALS(L::acquire(&c), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&c), 1u);
+	TEST_ASSERT_EQUALS(L::getStatistics().expirations, 1u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 0u);
+	TEST_ASSERT_EQUALS(L::release(&c), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 1u);
+	TEST_ASSERT_EQUALS(L::release(&b), 0u);
+}
+
+void
+SpiLockTest::testExpirationQueue()
+{
+	using L = Lock<5>;
+	int a, b, c, d;
+	TEST_ASSERT_EQUALS(L::acquire(&a), 1u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&c), 0u);
+	TEST_ASSERT_EQUALS(L::release(&a), 0u);
+
+	// b gave up, so the reservation passes to c after one pass of d
+	TEST_ASSERT_EQUALS(L::acquire(&d), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&d), 0u);
+	TEST_ASSERT_EQUALS(L::getStatistics().expirations, 1u);
+	// d is queued now and gets the lock after c
+	TEST_ASSERT_EQUALS(L::acquire(&c), 1u);
+	TEST_ASSERT_EQUALS(L::acquire(&d), 0u);
+	TEST_ASSERT_EQUALS(L::release(&c), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&d), 1u);
+	TEST_ASSERT_EQUALS(L::release(&d), 0u);
+	TEST_ASSERT_EQUALS(L::getWaiters(), 0u);
+}
+
+void
+SpiLockTest::testDisabled()
+{
+	using L = Lock<6, 0>;
+	int a, b;
+	TEST_ASSERT_EQUALS(L::acquire(&a), 1u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 0u);
+	TEST_ASSERT_EQUALS(L::getWaiters(), 0u);
+	TEST_ASSERT_EQUALS(L::release(&a), 0u);
+	// without queue the first context takes the lock
+	TEST_ASSERT_EQUALS(L::acquire(&a), 1u);
+	TEST_ASSERT_EQUALS(L::release(&a), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 1u);
+	TEST_ASSERT_FALSE(L::cancel(&a));
+	TEST_ASSERT_EQUALS(L::release(&b), 0u);
+	TEST_ASSERT_EQUALS(L::getStatistics().contentions, 1u);
+	TEST_ASSERT_EQUALS(L::getStatistics().handOffs, 0u);
+}
+
+void
+SpiLockTest::testCancel()
+{
+	using L = Lock<4>;
+	int a, b, c;
+	TEST_ASSERT_EQUALS(L::acquire(&a), 1u);
+	TEST_ASSERT_EQUALS(L::acquire(&b), 0u);
+	TEST_ASSERT_EQUALS(L::acquire(&c), 0u);
+	TEST_ASSERT_TRUE(L::cancel(&b));
+	TEST_ASSERT_FALSE(L::cancel(&b));
+	TEST_ASSERT_EQUALS(L::getWaiters(), 1u);
+
+	TEST_ASSERT_EQUALS(L::release(&a), 0u);
+	// c gives up the hand-off
+	TEST_ASSERT_TRUE(L::cancel(&c));
+	TEST_ASSERT_EQUALS(L::acquire(&b), 1u);
+	TEST_ASSERT_EQUALS(L::release(&b), 0u);
+}
+
+void
+SpiLockTest::testFairness()
+{
+	using Master = modm_test::platform::SpiMaster;
+	test_clock::setTime(0);
+	Master::resetStatistics();
+
+	// the display is polled first and immediately requests the bus again
+	Device display(5ms), sensor(1ms);
+	for (int ms = 0; ms < 1000; ++ms)
+	{
+		display.update();
+		sensor.update();
+		test_clock::increment(1);
+	}
+	// the bus alternates between both devices every 7ms, instead of the
+	// display keeping the bus forever
+	TEST_ASSERT_TRUE(sensor.transfers >= 140u);
+	TEST_ASSERT_TRUE(display.transfers >= 140u);
+	// the display hold time plus one polling period
+	TEST_ASSERT_TRUE(sensor.maxWait <= 6ms);
+	TEST_ASSERT_TRUE(display.maxWait <= 2ms);
+	TEST_ASSERT_EQUALS(Master::getStatistics().expirations, 0u);
+	TEST_ASSERT_EQUALS(Master::getStatistics().maxWaiters, 1u);
+	TEST_ASSERT_TRUE(Master::getStatistics().maxHold <= 5u);
+
+	display.reset();
+	sensor.reset();
+	TEST_ASSERT_TRUE(Master::acquire(this) == 1);
+	Master::release(this);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, Niklas Hauser
+ * Copyright (c) 2020, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -29,6 +29,28 @@ public:
 	using Message::self;
 };
 
+/// Only implements the byte-wise interface of a device
+class ByteDevice : public Device
+{
+public:
+	bool
+	hasReceived() override
+	{ return dev.hasReceived(); }
+
+	modm::ResumableResult<bool>
+	write(uint8_t data) override
+	{ return dev.write(data); }
+
+	modm::ResumableResult<bool>
+	read(uint8_t *data) override
+	{ return dev.read(data); }
+
+	using Device::write;
+
+private:
+	DeviceWrapper<SharedMedium> dev;
+};
+
 void
 AmnbInterfaceTest::setUp()
 {
@@ -297,3 +319,102 @@ AmnbInterfaceTest::testInterlock()
 	TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.receiveHeader(&rx_msg)), InterfaceStatus::HeaderInvalid);
 	TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.transmit(&tx_msg)), InterfaceStatus::Ok);
 }
+
+void
+AmnbInterfaceTest::testBatch()
+{
+	DeviceWrapper<SharedMedium> dev;
+	Interface<100, 32> interface(dev);
+
+	AmnbTestMessage msg1(7, 0x7D);
+	msg1.setValid();
+	AmnbTestMessage msg2(200, 0x7E, 8, Type::Request);
+	msg2.get<uint32_t>()[0] = 0x03020100ul;
+	msg2.get<uint32_t>()[1] = 0x07067E7Dul;
+	msg2.setValid();
+	// larger than the transmit buffer
+	AmnbTestMessage msg3(10, 14, 32, Type::Error);
+	for (size_t ii=0; ii < 32/sizeof(uint32_t); ii++)
+		msg3.get<uint32_t>()[ii] = 0x0302017Dul+ii;
+	msg3.setValid();
+	const Message* batch[] = {&msg1, &msg2, &msg3};
+
+	const uint8_t raw[] = {
+		0x7E, 0x7E, 108, 7, 0x7D, 0x5D, 0,
+		0x7E, 0x7E, 18, 200, 0x7D, 0x5E, 0x48, 0, 1, 2, 3, 0x7D, 0x5D, 0x7D, 0x5E, 6, 7,
+		0x7E, 0x7E, 8, 10, 14, 0x9F, 32, 0, 205, 202,
+			0x7D, 0x5D, 1, 2, 3,  0x7D, 0x5E, 1, 2, 3,  0x7F, 1, 2, 3,  0x80, 1, 2, 3,
+			      0x81, 1, 2, 3,        0x82, 1, 2, 3,  0x83, 1, 2, 3,  0x84, 1, 2, 3};
+	{
+		// all frames are written back-to-back with their own sync and CRC
+		TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.transmit(batch, 3)), InterfaceStatus::Ok);
+		TEST_ASSERT_EQUALS(interface.transmitted(), 3u);
+		TEST_ASSERT_EQUALS(SharedMedium::transmitted.size(), sizeof(raw));
+		TEST_ASSERT_EQUALS_ARRAY(SharedMedium::transmitted, raw, sizeof(raw));
+	}
+	SharedMedium::reset();
+	{
+		// the first two frames are written in one block before the third one fails
+		SharedMedium::fail_tx_index = 30;
+		TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.transmit(batch, 3)), InterfaceStatus::DataWriteFailed);
+		TEST_ASSERT_EQUALS(interface.transmitted(), 2u);
+		TEST_ASSERT_EQUALS_ARRAY(SharedMedium::raw_transmitted, raw, 24);
+		// medium is released again
+		TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.transmit(batch, 1)), InterfaceStatus::Ok);
+		TEST_ASSERT_EQUALS(interface.transmitted(), 1u);
+	}
+	SharedMedium::reset();
+	{
+		// a busy medium after a successful batch writes nothing
+		TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.transmit(batch, 3)), InterfaceStatus::Ok);
+		TEST_ASSERT_EQUALS(interface.transmitted(), 3u);
+		SharedMedium::received.push_back(0x7E);
+		TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.transmit(batch, 3)), InterfaceStatus::MediumBusy);
+		TEST_ASSERT_EQUALS(interface.transmitted(), 0u);
+		TEST_ASSERT_EQUALS(SharedMedium::transmitted.size(), sizeof(raw));
+	}
+	SharedMedium::reset();
+	{
+		// devices without a block write fall back to writing byte by byte
+		ByteDevice byteDev;
+		Interface<100, 32> byteInterface(byteDev);
+		TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(byteInterface.transmit(batch, 3)), InterfaceStatus::Ok);
+		TEST_ASSERT_EQUALS(byteInterface.transmitted(), 3u);
+		TEST_ASSERT_EQUALS_ARRAY(SharedMedium::transmitted, raw, sizeof(raw));
+
+		SharedMedium::reset();
+		SharedMedium::fail_tx_index = 30;
+		TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(byteInterface.transmit(batch, 3)), InterfaceStatus::DataWriteFailed);
+		TEST_ASSERT_EQUALS(byteInterface.transmitted(), 2u);
+		// the next block write starts at the beginning again
+		TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(byteInterface.transmit(batch, 1)), InterfaceStatus::Ok);
+		TEST_ASSERT_EQUALS(byteInterface.transmitted(), 1u);
+	}
+	SharedMedium::reset();
+	{
+		// the receiver parses the batch as a stream of frames
+		SharedMedium::received.insert(SharedMedium::received.end(), raw, raw + sizeof(raw));
+		{
+			AmnbTestMessage msg;
+			TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.receiveHeader(&msg)), InterfaceStatus::Ok);
+			TEST_ASSERT_EQUALS(msg.address(), 7);
+			TEST_ASSERT_EQUALS(msg.command(), 0x7D);
+			TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.receiveData(&msg)), InterfaceStatus::Ok);
+		}{
+			AmnbTestMessage msg;
+			TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.receiveHeader(&msg)), InterfaceStatus::Ok);
+			TEST_ASSERT_EQUALS(msg.address(), 200);
+			TEST_ASSERT_EQUALS(msg.length(), 8);
+			TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.receiveData(&msg)), InterfaceStatus::Ok);
+			TEST_ASSERT_EQUALS(msg.get<uint32_t>()[1], 0x07067E7Dul);
+		}{
+			AmnbTestMessage msg;
+			TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.receiveHeader(&msg)), InterfaceStatus::Ok);
+			TEST_ASSERT_EQUALS(msg.address(), 10);
+			TEST_ASSERT_EQUALS(msg.length(), 32);
+			TEST_ASSERT_EQUALS(RF_CALL_BLOCKING(interface.receiveData(&msg)), InterfaceStatus::Ok);
+			TEST_ASSERT_EQUALS(msg.get<uint32_t>()[7], 0x03020184ul);
+		}
+		TEST_ASSERT_TRUE(SharedMedium::received.empty());
+	}
+}
@@ -20,4 +20,5 @@ public:
 	void testSerialize();
 	void testFailures();
 	void testInterlock();
+	void testBatch();
 };
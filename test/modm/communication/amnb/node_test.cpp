@@ -320,3 +320,59 @@ AmnbNodeTest::testListener()
 		TEST_ASSERT_EQUALS(count, 11+21+12+22);
 	}
 }
+
+void
+AmnbNodeTest::testBatch()
+{
+	const uint8_t raw[] = {0x7E, 0x7E, 84, 0x08, 0x10, 0,
+	                       0x7E, 0x7E, 58, 0x08, 0x20, 4, 0, 1, 2, 3,
+	                       0x7E, 0x7E, 84, 0x08, 0x10, 0,
+	                       0x7E, 0x7E, 58, 0x08, 0x20, 4, 0, 1, 2, 3};
+	const auto queue = [](auto& node)
+	{
+		node.broadcast(0x10);
+		node.broadcast(0x20, uint32_t(0x03020100));
+		node.broadcast(0x10);
+		node.broadcast(0x20, uint32_t(0x03020100));
+	};
+	const auto passes = [](auto& node)
+	{
+		size_t passes{0};
+		micro_clock::setTime(0);
+		for (; SharedMedium::transmitted.size() < sizeof(raw) and passes < 100; passes++)
+		{ node.update(); micro_clock::increment(10); }
+		return passes;
+	};
+	{
+		// without batching every message needs its own medium access
+		DeviceWrapper<SharedMedium> dev;
+		Node<4> node(dev, 0x08);
+		queue(node);
+		TEST_ASSERT_EQUALS(passes(node), 4u);
+		TEST_ASSERT_EQUALS(SharedMedium::transmitted.size(), sizeof(raw));
+		TEST_ASSERT_EQUALS_ARRAY(SharedMedium::transmitted, raw, sizeof(raw));
+	}
+	SharedMedium::reset();
+	{
+		// with batching the whole queue is written in one medium access
+		DeviceWrapper<SharedMedium> dev;
+		Node<4, 0, 64> node(dev, 0x08);
+		queue(node);
+		TEST_ASSERT_EQUALS(passes(node), 1u);
+		TEST_ASSERT_EQUALS(SharedMedium::transmitted.size(), sizeof(raw));
+		TEST_ASSERT_EQUALS_ARRAY(SharedMedium::transmitted, raw, sizeof(raw));
+	}
+	SharedMedium::reset();
+	{
+		// a collision in the second frame only retransmits the remaining frames
+		DeviceWrapper<SharedMedium> dev;
+		Node<4, 0, 16> node(dev, 0x08);
+		queue(node);
+		SharedMedium::fail_tx_index = 8;
+		for(uint32_t ii=0; ii < 20000; ii += 10) { node.update(); micro_clock::setTime(ii); }
+		// 16B buffer fits one frame per block: first frame, failed block, then all three
+		TEST_ASSERT_EQUALS(SharedMedium::raw_transmitted.size(), 6u + 10u + 26u);
+		TEST_ASSERT_EQUALS_ARRAY(SharedMedium::raw_transmitted, raw, 6);
+		TEST_ASSERT_EQUALS_ARRAY(&SharedMedium::raw_transmitted[16], &raw[6], 26);
+	}
+}
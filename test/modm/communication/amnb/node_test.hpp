@@ -21,4 +21,5 @@ public:
 	void testRequest();
 	void testAction();
 	void testListener();
+	void testBatch();
 };
@@ -18,12 +18,14 @@
 
 using FakeIODevice = modm_test::FakeIODevice;
 typedef modm::sab::Interface<FakeIODevice> TestingInterface;
+typedef modm::sab::Interface<FakeIODevice, 2> TestingQueueInterface;
 
 void
 InterfaceTest::setUp()
 {
 	// set up everything
 	TestingInterface::initialize();
+	TestingQueueInterface::initialize();
 	FakeIODevice::reset();
 }
 
@@ -183,3 +185,93 @@ InterfaceTest::testReceiveNack()
 			reinterpret_cast<uint8_t *>(&data),
 			4);
 }
+
+// ----------------------------------------------------------------------------
+void
+InterfaceTest::testReceiveQueue()
+{
+	TestingQueueInterface interface;
+
+	interface.sendMessage(0x01, modm::sab::REQUEST, 0x10, uint8_t(0xa1));
+	interface.sendMessage(0x02, modm::sab::ACK, 0x20, uint8_t(0xa2));
+	interface.sendMessage(0x03, modm::sab::NACK, 0x30, uint8_t(0xa3));
+	FakeIODevice::moveSendToReceiveBuffer();
+
+	interface.update();
+
+	// the third frame does not fit into the queue anymore
+	TEST_ASSERT_TRUE(interface.isMessageAvailable());
+	TEST_ASSERT_EQUALS(interface.getAddress(), 0x01);
+	TEST_ASSERT_EQUALS(interface.getCommand(), 0x10);
+	TEST_ASSERT_EQUALS(interface.getPayloadLength(), 1);
+	TEST_ASSERT_EQUALS(interface.getPayload()[0], 0xa1);
+	interface.dropMessage();
+
+	// a new frame is received while the current one is processed
+	interface.sendMessage(0x04, modm::sab::REQUEST, 0x40, uint8_t(0xa4));
+	FakeIODevice::moveSendToReceiveBuffer();
+	uint8_t byte;
+	for (uint8_t ii = 0; ii < 4; ++ii)
+	{
+		TEST_ASSERT_TRUE(FakeIODevice::read(byte));
+		interface.parse(byte);
+	}
+
+	TEST_ASSERT_TRUE(interface.isMessageAvailable());
+	TEST_ASSERT_TRUE(interface.isAcknowledge());
+	TEST_ASSERT_EQUALS(interface.getAddress(), 0x02);
+	TEST_ASSERT_EQUALS(interface.getCommand(), 0x20);
+	TEST_ASSERT_EQUALS(interface.getPayload()[0], 0xa2);
+
+	interface.update();
+	TEST_ASSERT_EQUALS(interface.getAddress(), 0x02);
+	TEST_ASSERT_EQUALS(interface.getPayload()[0], 0xa2);
+	interface.dropMessage();
+
+	TEST_ASSERT_TRUE(interface.isMessageAvailable());
+	TEST_ASSERT_EQUALS(interface.getAddress(), 0x04);
+	TEST_ASSERT_EQUALS(interface.getCommand(), 0x40);
+	TEST_ASSERT_EQUALS(interface.getPayload()[0], 0xa4);
+	interface.dropMessage();
+
+	TEST_ASSERT_FALSE(interface.isMessageAvailable());
+	TEST_ASSERT_EQUALS(interface.getPayloadLength(), 0);
+}
+
+void
+InterfaceTest::testReceiveStream()
+{
+	TestingQueueInterface interface;
+
+	uint16_t received = 0;
+	for (uint16_t ii = 0; ii < 1000; ++ii)
+	{
+		uint32_t data = 0xdead0000 | ii;
+		interface.sendMessage(ii & 0x3f, modm::sab::REQUEST, ii, data);
+		// corrupt every tenth frame
+		if (ii % 10 == 9) {
+			FakeIODevice::sendBuffer[5] ^= 0x01;
+		}
+		FakeIODevice::moveSendToReceiveBuffer();
+
+		// feed the frame byte-wise like the receive interrupt would
+		uint8_t byte;
+		while (FakeIODevice::read(byte)) {
+			interface.parse(byte);
+		}
+
+		// process the frames with a delay of one frame
+		if (ii & 1)
+		{
+			while (interface.isMessageAvailable())
+			{
+				TEST_ASSERT_EQUALS(interface.getPayloadLength(), 4);
+				TEST_ASSERT_EQUALS(interface.getPayload()[3], 0xde);
+				TEST_ASSERT_EQUALS(interface.getPayload()[2], 0xad);
+				received++;
+				interface.dropMessage();
+			}
+		}
+	}
+	TEST_ASSERT_EQUALS(received, 900);
+}
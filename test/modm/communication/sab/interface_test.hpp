@@ -37,4 +37,10 @@ public:
 
 	void
 	testReceiveNack();
+
+	void
+	testReceiveQueue();
+
+	void
+	testReceiveStream();
 };
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/communication/xpcc/postman/dynamic_postman.hpp>
+#include <unittest/benchmark.hpp>
+
+#include "dynamic_postman_test.hpp"
+
+namespace
+{
+	struct Receiver
+	{
+		uint32_t word = 0;
+		uint16_t half = 0;
+		uint8_t simple = 0;
+		uint8_t actions = 0;
+
+		void onWord(const xpcc::Header&, const uint32_t& value) { word = value; }
+		void onHalf(const xpcc::Header&, const uint16_t& value) { half = value; }
+		void onSimple(const xpcc::Header&) { simple++; }
+		void onAction(const xpcc::ResponseHandle&, const uint32_t& value) { word = value; actions++; }
+	};
+
+	const xpcc::Header
+	event(uint8_t id)
+	{ return xpcc::Header(xpcc::Header::Type::REQUEST, false, 0, 1, id); }
+
+	const xpcc::Header
+	action(uint8_t component, uint8_t id)
+	{ return xpcc::Header(xpcc::Header::Type::REQUEST, false, component, 1, id); }
+}
+
+void
+DynamicPostmanTest::testEventPayloadSize()
+{
+	Receiver receiver;
+	xpcc::DynamicPostman postman;
+	postman.registerEventListener(0x10, &receiver, &Receiver::onSimple);
+	postman.registerEventListener(0x10, &receiver, &Receiver::onWord);
+	postman.registerEventListener(0x10, &receiver, &Receiver::onHalf);
+	postman.registerEventListener(0x20, &receiver, &Receiver::onSimple);
+	postman.registerEventListener(0x20, &receiver, &Receiver::onWord);
+
+	// a payload not matching all listeners is rejected before any dispatch
+	const uint32_t word = 0x12345678;
+	modm::SmartPointer wordPayload(&word);
+	TEST_ASSERT_EQUALS(postman.deliverPacket(event(0x10), wordPayload),
+					   xpcc::Postman::WRONG_EVENT_PARAMETER);
+	TEST_ASSERT_EQUALS(receiver.word, 0u);
+	TEST_ASSERT_EQUALS(receiver.half, 0u);
+	TEST_ASSERT_EQUALS(receiver.simple, 0u);
+
+	// listeners without parameter accept any payload
+	TEST_ASSERT_EQUALS(postman.deliverPacket(event(0x20), wordPayload), xpcc::Postman::OK);
+	TEST_ASSERT_EQUALS(receiver.word, 0x12345678u);
+	TEST_ASSERT_EQUALS(receiver.simple, 1u);
+
+	const uint16_t half = 0xabcd;
+	modm::SmartPointer halfPayload(&half);
+	TEST_ASSERT_EQUALS(postman.deliverPacket(event(0x20), halfPayload),
+					   xpcc::Postman::WRONG_EVENT_PARAMETER);
+	TEST_ASSERT_EQUALS(receiver.simple, 1u);
+	TEST_ASSERT_EQUALS(receiver.half, 0u);
+}
+
+void
+DynamicPostmanTest::testActionPayloadSize()
+{
+	Receiver receiver;
+	xpcc::DynamicPostman postman;
+	postman.registerActionHandler(0x03, 0x40, &receiver, &Receiver::onAction);
+
+	const uint16_t half = 0xabcd;
+	modm::SmartPointer halfPayload(&half);
+	TEST_ASSERT_EQUALS(postman.deliverPacket(action(0x03, 0x40), halfPayload),
+					   xpcc::Postman::WRONG_ACTION_PARAMETER);
+	TEST_ASSERT_EQUALS(receiver.actions, 0u);
+
+	const uint32_t word = 0x12345678;
+	modm::SmartPointer wordPayload(&word);
+	TEST_ASSERT_EQUALS(postman.deliverPacket(action(0x03, 0x40), wordPayload), xpcc::Postman::OK);
+	TEST_ASSERT_EQUALS(receiver.actions, 1u);
+	TEST_ASSERT_EQUALS(receiver.word, 0x12345678u);
+}
+
+void
+DynamicPostmanTest::testNoReceiver()
+{
+	Receiver receiver;
+	xpcc::DynamicPostman postman;
+	postman.registerActionHandler(0x03, 0x40, &receiver, &Receiver::onAction);
+
+	modm::SmartPointer payload;
+	TEST_ASSERT_EQUALS(postman.deliverPacket(event(0x10), payload), xpcc::Postman::NO_EVENT);
+	TEST_ASSERT_EQUALS(postman.deliverPacket(action(0x04, 0x40), payload), xpcc::Postman::NO_COMPONENT);
+	TEST_ASSERT_EQUALS(postman.deliverPacket(action(0x03, 0x41), payload), xpcc::Postman::NO_ACTION);
+	TEST_ASSERT_TRUE(postman.isComponentAvailable(0x03));
+	TEST_ASSERT_FALSE(postman.isComponentAvailable(0x04));
+}
+
+void
+DynamicPostmanTest::benchmarkDeliverEvent()
+{
+	Receiver receiver;
+	xpcc::DynamicPostman postman;
+	postman.registerEventListener(0x10, &receiver, &Receiver::onSimple);
+	postman.registerEventListener(0x10, &receiver, &Receiver::onWord);
+	const uint32_t word = 0x12345678;
+	modm::SmartPointer payload(&word);
+	const xpcc::Header header = event(0x10);
+
+	TEST_BENCHMARK("deliverPacket event", 1000, {
+		auto info = postman.deliverPacket(header, payload);
+		unittest::doNotOptimize(info);
+	});
+}
+
+void
+DynamicPostmanTest::benchmarkDeliverAction()
+{
+	Receiver receiver;
+	xpcc::DynamicPostman postman;
+	for (uint8_t component = 1; component < 8; component++)
+		postman.registerActionHandler(component, 0x40, &receiver, &Receiver::onAction);
+	const uint32_t word = 0x12345678;
+	modm::SmartPointer payload(&word);
+	const xpcc::Header header = action(0x05, 0x40);
+
+	TEST_BENCHMARK("deliverPacket action", 1000, {
+		auto info = postman.deliverPacket(header, payload);
+		unittest::doNotOptimize(info);
+	});
+}
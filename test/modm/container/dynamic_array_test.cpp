@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2010, Fabian Greif
- * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2012, 2026, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
  *
  * This file is part of the modm project.
@@ -18,6 +18,33 @@
 
 typedef modm::DynamicArray<int16_t> Container;
 
+namespace
+{
+	/// Counts copies and moves, cannot be relocated with memcpy
+	struct Tracked
+	{
+		static inline std::size_t copies = 0;
+		static inline std::size_t moves = 0;
+
+		Tracked(int16_t value = 0) : value(value) {}
+		Tracked(const Tracked& other) : value(other.value) { copies++; }
+		Tracked(Tracked&& other) : value(other.value) { other.value = -1; moves++; }
+		Tracked& operator = (const Tracked& other) { value = other.value; copies++; return *this; }
+		Tracked& operator = (Tracked&& other) { value = other.value; other.value = -1; moves++; return *this; }
+
+		int16_t value;
+	};
+
+	struct MoveOnly
+	{
+		MoveOnly(int16_t a, int16_t b) : value(a + b) {}
+		MoveOnly(MoveOnly&&) = default;
+		MoveOnly(const MoveOnly&) = delete;
+
+		int16_t value;
+	};
+}
+
 void
 DynamicArrayTest::setUp()
 {
@@ -324,3 +351,146 @@ DynamicArrayTest::testIteratorAccess()
 	(*it).b = 22312;
 	TEST_ASSERT_EQUALS(it->b, 22312);
 }
+
+void
+DynamicArrayTest::testCopyAssignment()
+{
+	Container array{1, 2, 3};
+	array.reserve(20);
+
+	// the copy does not take over the unused capacity
+	Container copy(array);
+	TEST_ASSERT_EQUALS(copy.getSize(), 3U);
+	TEST_ASSERT_EQUALS(copy.getCapacity(), 3U);
+	TEST_ASSERT_EQUALS(copy[2], 3);
+
+	Container other{4, 5};
+	other = array;
+	TEST_ASSERT_EQUALS(other.getSize(), 3U);
+	TEST_ASSERT_EQUALS(other[0], 1);
+	TEST_ASSERT_EQUALS(other[2], 3);
+
+	other = static_cast<const Container&>(other);
+	TEST_ASSERT_EQUALS(other.getSize(), 3U);
+	TEST_ASSERT_EQUALS(other[1], 2);
+}
+
+void
+DynamicArrayTest::testMove()
+{
+	modm::DynamicArray<Tracked> array;
+	for (int16_t ii = 0; ii < 10; ++ii) array.append(Tracked(ii));
+	Tracked::copies = 0;
+	Tracked::moves = 0;
+
+	modm::DynamicArray<Tracked> moved(std::move(array));
+	TEST_ASSERT_TRUE(array.isEmpty());
+	TEST_ASSERT_EQUALS(array.getCapacity(), 0U);
+	TEST_ASSERT_EQUALS(moved.getSize(), 10U);
+	TEST_ASSERT_EQUALS(moved[9].value, 9);
+
+	modm::DynamicArray<Tracked> assigned{Tracked(42)};
+	Tracked::copies = 0;
+	assigned = std::move(moved);
+	TEST_ASSERT_TRUE(moved.isEmpty());
+	TEST_ASSERT_EQUALS(assigned.getSize(), 10U);
+	TEST_ASSERT_EQUALS(assigned[0].value, 0);
+
+	// the elements themselves are neither copied nor moved
+	TEST_ASSERT_EQUALS(Tracked::copies, 0U);
+	TEST_ASSERT_EQUALS(Tracked::moves, 0U);
+
+	// the moved-from array can be reused
+	array.append(Tracked(7));
+	TEST_ASSERT_EQUALS(array[0].value, 7);
+}
+
+void
+DynamicArrayTest::testEmplaceBack()
+{
+	modm::DynamicArray<MoveOnly> array;
+	for (int16_t ii = 0; ii < 10; ++ii)
+	{
+		MoveOnly& element = array.emplaceBack(ii, 100);
+		TEST_ASSERT_EQUALS(element.value, ii + 100);
+	}
+	TEST_ASSERT_EQUALS(array.getSize(), 10U);
+	TEST_ASSERT_EQUALS(array.getFront().value, 100);
+	TEST_ASSERT_EQUALS(array.getBack().value, 109);
+
+	// relocation moves the elements instead of copying them
+	modm::DynamicArray<Tracked> tracked;
+	Tracked::copies = 0;
+	for (int16_t ii = 0; ii < 20; ++ii) tracked.emplaceBack(ii);
+	TEST_ASSERT_EQUALS(Tracked::copies, 0U);
+	for (int16_t ii = 0; ii < 20; ++ii) {
+		TEST_ASSERT_EQUALS(tracked[ii].value, ii);
+	}
+}
+
+void
+DynamicArrayTest::testAppendOwnElement()
+{
+	modm::DynamicArray<Tracked> array;
+	array.append(Tracked(5));
+	for (uint8_t ii = 0; ii < 10; ++ii)
+	{
+		// may reallocate while the argument refers to the old storage
+		array.append(array.getFront());
+	}
+	for (const Tracked& element : array) {
+		TEST_ASSERT_EQUALS(element.value, 5);
+	}
+}
+
+void
+DynamicArrayTest::testGrowth()
+{
+	modm::DynamicArray<int16_t, modm::allocator::Dynamic<int16_t>, std::ratio<2>> array;
+	std::size_t reallocations = 0;
+	std::size_t capacity = array.getCapacity();
+	for (int16_t ii = 0; ii < 100; ++ii)
+	{
+		array.append(ii);
+		if (array.getCapacity() != capacity)
+		{
+			TEST_ASSERT_TRUE(array.getCapacity() >= 2 * capacity);
+			capacity = array.getCapacity();
+			reallocations++;
+		}
+	}
+	TEST_ASSERT_EQUALS(reallocations, 8U);
+	TEST_ASSERT_EQUALS(array[99], 99);
+
+	// the default growth factor is 1.5
+	Container container;
+	for (int16_t ii = 0; ii < 100; ++ii) container.append(ii);
+	TEST_ASSERT_TRUE(container.getCapacity() < 150);
+
+	// the growth is rounded up
+	Container odd{1, 2, 3};
+	odd.shrinkToFit();
+	TEST_ASSERT_EQUALS(odd.getCapacity(), 3U);
+	odd.append(4);
+	TEST_ASSERT_EQUALS(odd.getCapacity(), 5U);
+}
+
+void
+DynamicArrayTest::testShrinkToFit()
+{
+	Container array;
+	array.reserve(100);
+	array.append(1);
+	array.append(2);
+
+	array.shrinkToFit();
+	TEST_ASSERT_EQUALS(array.getCapacity(), 2U);
+	TEST_ASSERT_EQUALS(array[0], 1);
+	TEST_ASSERT_EQUALS(array[1], 2);
+
+	array.removeAll();
+	array.shrinkToFit();
+	TEST_ASSERT_EQUALS(array.getCapacity(), 0U);
+	array.append(3);
+	TEST_ASSERT_EQUALS(array[0], 3);
+}
@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2010, Fabian Greif
- * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2012, 2026, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
  *
  * This file is part of the modm project.
@@ -51,6 +51,24 @@ public:
 	void
 	testRemoveAll();
 
+	void
+	testCopyAssignment();
+
+	void
+	testMove();
+
+	void
+	testEmplaceBack();
+
+	void
+	testAppendOwnElement();
+
+	void
+	testGrowth();
+
+	void
+	testShrinkToFit();
+
 	// iterators
 	void
 	testConstIterator();
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/intrusive_doubly_linked_list.hpp>
+#include <modm/container/doubly_linked_list.hpp>
+#include <unittest/benchmark.hpp>
+#include <iterator>
+
+#include "intrusive_doubly_linked_list_test.hpp"
+
+namespace
+{
+	struct Node : modm::IntrusiveDoublyLinkedListHook<>
+	{
+		Node(int16_t value = 0) : value(value) {}
+		int16_t value;
+	};
+
+	using List = modm::IntrusiveDoublyLinkedList<Node>;
+}
+
+void
+IntrusiveDoublyLinkedListTest::testAppendPrepend()
+{
+	Node nodes[3]{1, 2, 3};
+	List list;
+
+	TEST_ASSERT_TRUE(list.isEmpty());
+	TEST_ASSERT_EQUALS(list.getSize(), 0U);
+	TEST_ASSERT_TRUE(list.begin() == list.end());
+
+	list.append(nodes[1]);
+	TEST_ASSERT_TRUE(nodes[1].isLinked());
+	TEST_ASSERT_EQUALS(&list.getFront(), &nodes[1]);
+	TEST_ASSERT_EQUALS(&list.getBack(), &nodes[1]);
+
+	list.append(nodes[2]);
+	list.prepend(nodes[0]);
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_EQUALS(list.getFront().value, 1);
+	TEST_ASSERT_EQUALS(list.getBack().value, 3);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testRemoveFrontBack()
+{
+	Node nodes[3]{1, 2, 3};
+	List list;
+	for (Node& node : nodes) list.append(node);
+
+	list.removeFront();
+	TEST_ASSERT_FALSE(nodes[0].isLinked());
+	TEST_ASSERT_EQUALS(list.getFront().value, 2);
+	list.removeBack();
+	TEST_ASSERT_FALSE(nodes[2].isLinked());
+	TEST_ASSERT_EQUALS(list.getBack().value, 2);
+	list.removeBack();
+	TEST_ASSERT_TRUE(list.isEmpty());
+
+	for (Node& node : nodes) list.append(node);
+	list.removeAll();
+	TEST_ASSERT_TRUE(list.isEmpty());
+	TEST_ASSERT_FALSE(nodes[1].isLinked());
+}
+
+void
+IntrusiveDoublyLinkedListTest::testIterator()
+{
+	Node nodes[4]{1, 2, 3, 4};
+	List list;
+	for (Node& node : nodes) list.append(node);
+
+	int16_t expected = 1;
+	for (const Node& node : list) {
+		TEST_ASSERT_EQUALS(node.value, expected++);
+	}
+
+	expected = 4;
+	for (auto it = std::make_reverse_iterator(list.end());
+		 it != std::make_reverse_iterator(list.begin()); ++it) {
+		TEST_ASSERT_EQUALS(it->value, expected--);
+	}
+
+	const List& constList = list;
+	List::const_iterator it = list.end();
+	TEST_ASSERT_TRUE(it == constList.end());
+	TEST_ASSERT_EQUALS((--it)->value, 4);
+	TEST_ASSERT_EQUALS(std::distance(constList.begin(), constList.end()), 4);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testInsert()
+{
+	Node nodes[4]{1, 2, 3, 4};
+	List list;
+	list.append(nodes[0]);
+	list.append(nodes[2]);
+
+	// inserts before the position
+	list.insert(++list.begin(), nodes[1]);
+	list.insert(list.end(), nodes[3]);
+
+	int16_t expected = 1;
+	for (const Node& node : list) {
+		TEST_ASSERT_EQUALS(node.value, expected++);
+	}
+	TEST_ASSERT_EQUALS(expected, 5);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testUnlink()
+{
+	Node nodes[4]{1, 2, 3, 4};
+	List list;
+	for (Node& node : nodes) list.append(node);
+
+	nodes[1].unlink();
+	TEST_ASSERT_FALSE(nodes[1].isLinked());
+	nodes[1].unlink();
+	list.remove(nodes[3]);
+	TEST_ASSERT_EQUALS(list.getSize(), 2U);
+	TEST_ASSERT_EQUALS(&list.getBack(), &nodes[2]);
+
+	auto it = list.erase(list.begin());
+	TEST_ASSERT_EQUALS(&*it, &nodes[2]);
+	it = list.erase(it);
+	TEST_ASSERT_TRUE(it == list.end());
+	TEST_ASSERT_TRUE(list.isEmpty());
+}
+
+void
+IntrusiveDoublyLinkedListTest::testRelink()
+{
+	Node nodes[2]{1, 2};
+	List first;
+	List second;
+	first.append(nodes[0]);
+	first.append(nodes[1]);
+
+	// moving an element unlinks it from its previous list
+	second.append(nodes[0]);
+	TEST_ASSERT_EQUALS(first.getSize(), 1U);
+	TEST_ASSERT_EQUALS(&first.getFront(), &nodes[1]);
+	TEST_ASSERT_EQUALS(&second.getFront(), &nodes[0]);
+
+	// copies are not linked
+	Node copy(nodes[0]);
+	TEST_ASSERT_FALSE(copy.isLinked());
+	TEST_ASSERT_EQUALS(copy.value, 1);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testDestructor()
+{
+	Node outer{1};
+	List list;
+	{
+		Node inner{2};
+		list.append(outer);
+		list.append(inner);
+		TEST_ASSERT_EQUALS(list.getSize(), 2U);
+	}
+	TEST_ASSERT_EQUALS(list.getSize(), 1U);
+	TEST_ASSERT_EQUALS(&list.getBack(), &outer);
+	{
+		List inner;
+		inner.append(outer);
+	}
+	TEST_ASSERT_FALSE(outer.isLinked());
+	TEST_ASSERT_TRUE(list.isEmpty());
+}
+
+void
+IntrusiveDoublyLinkedListTest::benchmarkAppendRemove()
+{
+	static Node nodes[8];
+	List list;
+	TEST_BENCHMARK("IntrusiveDoublyLinkedList", 1000, {
+		for (Node& node : nodes) list.append(node);
+		while (not list.isEmpty()) list.removeFront();
+		unittest::doNotOptimize(list);
+	});
+}
+
+void
+IntrusiveDoublyLinkedListTest::benchmarkAppendRemoveAllocating()
+{
+	modm::DoublyLinkedList<int16_t> list;
+	TEST_BENCHMARK("DoublyLinkedList", 1000, {
+		for (int16_t ii = 0; ii < 8; ++ii) list.append(ii);
+		while (not list.isEmpty()) list.removeFront();
+		unittest::doNotOptimize(list);
+	});
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_container
+class IntrusiveDoublyLinkedListTest : public unittest::TestSuite
+{
+public:
+	void
+	testAppendPrepend();
+
+	void
+	testRemoveFrontBack();
+
+	void
+	testIterator();
+
+	void
+	testInsert();
+
+	void
+	testUnlink();
+
+	void
+	testRelink();
+
+	void
+	testDestructor();
+
+	void
+	benchmarkAppendRemove();
+
+	void
+	benchmarkAppendRemoveAllocating();
+};
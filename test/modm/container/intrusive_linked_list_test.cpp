@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/intrusive_linked_list.hpp>
+#include <modm/container/linked_list.hpp>
+#include <unittest/benchmark.hpp>
+#include <algorithm>
+
+#include "intrusive_linked_list_test.hpp"
+
+namespace
+{
+	struct Other;
+
+	struct Node : modm::IntrusiveLinkedListHook<>,
+				  modm::IntrusiveLinkedListHook<Other>
+	{
+		Node(int16_t value = 0) : value(value) {}
+		int16_t value;
+	};
+}
+
+void
+IntrusiveLinkedListTest::testAppendPrepend()
+{
+	Node nodes[3]{1, 2, 3};
+	modm::IntrusiveLinkedList<Node> list;
+
+	TEST_ASSERT_TRUE(list.isEmpty());
+	TEST_ASSERT_EQUALS(list.getSize(), 0U);
+
+	list.append(nodes[1]);
+	TEST_ASSERT_FALSE(list.isEmpty());
+	TEST_ASSERT_EQUALS(&list.getFront(), &nodes[1]);
+	TEST_ASSERT_EQUALS(&list.getBack(), &nodes[1]);
+
+	list.append(nodes[2]);
+	list.prepend(nodes[0]);
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_EQUALS(list.getFront().value, 1);
+	TEST_ASSERT_EQUALS(list.getBack().value, 3);
+}
+
+void
+IntrusiveLinkedListTest::testRemoveFront()
+{
+	Node nodes[3]{1, 2, 3};
+	modm::IntrusiveLinkedList<Node> list;
+	for (Node& node : nodes) list.append(node);
+
+	list.removeFront();
+	TEST_ASSERT_EQUALS(list.getFront().value, 2);
+	list.removeFront();
+	TEST_ASSERT_EQUALS(list.getFront().value, 3);
+	TEST_ASSERT_EQUALS(list.getBack().value, 3);
+	list.removeFront();
+	TEST_ASSERT_TRUE(list.isEmpty());
+
+	// the list is usable again after being emptied
+	list.append(nodes[1]);
+	TEST_ASSERT_EQUALS(&list.getFront(), &nodes[1]);
+	TEST_ASSERT_EQUALS(&list.getBack(), &nodes[1]);
+
+	list.removeAll();
+	TEST_ASSERT_TRUE(list.isEmpty());
+}
+
+void
+IntrusiveLinkedListTest::testIterator()
+{
+	Node nodes[4]{1, 2, 3, 4};
+	modm::IntrusiveLinkedList<Node> list;
+	for (Node& node : nodes) list.append(node);
+
+	int16_t expected = 1;
+	for (Node& node : list) {
+		TEST_ASSERT_EQUALS(node.value, expected++);
+		node.value *= 10;
+	}
+	TEST_ASSERT_EQUALS(expected, 5);
+
+	const modm::IntrusiveLinkedList<Node>& constList = list;
+	modm::IntrusiveLinkedList<Node>::const_iterator it = list.begin();
+	TEST_ASSERT_TRUE(it == constList.begin());
+	TEST_ASSERT_EQUALS(it->value, 10);
+	TEST_ASSERT_EQUALS((*++it).value, 20);
+
+	// works with the standard algorithms
+	auto found = std::find_if(constList.begin(), constList.end(),
+			[](const Node& node) { return node.value == 30; });
+	TEST_ASSERT_EQUALS(&*found, &nodes[2]);
+	TEST_ASSERT_EQUALS(std::distance(list.begin(), list.end()), 4);
+}
+
+void
+IntrusiveLinkedListTest::testInsert()
+{
+	Node nodes[4]{1, 2, 3, 4};
+	modm::IntrusiveLinkedList<Node> list;
+	list.append(nodes[0]);
+	list.append(nodes[2]);
+
+	list.insert(list.begin(), nodes[1]);
+	list.insert(list.end(), nodes[3]);
+
+	int16_t expected = 1;
+	for (const Node& node : list) {
+		TEST_ASSERT_EQUALS(node.value, expected++);
+	}
+	TEST_ASSERT_EQUALS(&list.getBack(), &nodes[3]);
+}
+
+void
+IntrusiveLinkedListTest::testRemove()
+{
+	Node nodes[4]{1, 2, 3, 4};
+	Node outside{5};
+	modm::IntrusiveLinkedList<Node> list;
+	for (Node& node : nodes) list.append(node);
+
+	TEST_ASSERT_FALSE(list.remove(outside));
+	TEST_ASSERT_TRUE(list.remove(nodes[3]));
+	TEST_ASSERT_EQUALS(&list.getBack(), &nodes[2]);
+	TEST_ASSERT_TRUE(list.remove(nodes[0]));
+	TEST_ASSERT_EQUALS(&list.getFront(), &nodes[1]);
+
+	auto it = list.remove(list.begin());
+	TEST_ASSERT_EQUALS(&*it, &nodes[2]);
+	it = list.remove(it);
+	TEST_ASSERT_TRUE(it == list.end());
+	TEST_ASSERT_TRUE(list.isEmpty());
+}
+
+void
+IntrusiveLinkedListTest::testMultipleHooks()
+{
+	Node nodes[3]{1, 2, 3};
+	modm::IntrusiveLinkedList<Node> all;
+	modm::IntrusiveLinkedList<Node, Other> odd;
+	for (Node& node : nodes)
+	{
+		all.append(node);
+		if (node.value & 1) odd.append(node);
+	}
+	TEST_ASSERT_EQUALS(all.getSize(), 3U);
+	TEST_ASSERT_EQUALS(odd.getSize(), 2U);
+	TEST_ASSERT_EQUALS(&odd.getFront(), &nodes[0]);
+	TEST_ASSERT_EQUALS(&odd.getBack(), &nodes[2]);
+
+	odd.removeFront();
+	TEST_ASSERT_EQUALS(all.getSize(), 3U);
+}
+
+void
+IntrusiveLinkedListTest::benchmarkAppendRemove()
+{
+	static Node nodes[8];
+	modm::IntrusiveLinkedList<Node> list;
+	TEST_BENCHMARK("IntrusiveLinkedList", 1000, {
+		for (Node& node : nodes) list.append(node);
+		while (not list.isEmpty()) list.removeFront();
+		unittest::doNotOptimize(list);
+	});
+}
+
+void
+IntrusiveLinkedListTest::benchmarkAppendRemoveAllocating()
+{
+	modm::LinkedList<Node> list;
+	TEST_BENCHMARK("LinkedList", 1000, {
+		for (int16_t ii = 0; ii < 8; ++ii) list.append(Node(ii));
+		while (not list.isEmpty()) list.removeFront();
+		unittest::doNotOptimize(list);
+	});
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/intrusive_queue.hpp>
+#include <unittest/benchmark.hpp>
+
+#include "intrusive_queue_test.hpp"
+
+namespace
+{
+	struct Node : modm::IntrusiveLinkedListHook<>
+	{
+		Node(int16_t value = 0) : value(value) {}
+		int16_t value;
+	};
+}
+
+void
+IntrusiveQueueTest::testEmpty()
+{
+	modm::IntrusiveQueue<Node> queue;
+
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_TRUE(queue.pop() == nullptr);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void
+IntrusiveQueueTest::testOrder()
+{
+	Node nodes[4]{1, 2, 3, 4};
+	modm::IntrusiveQueue<Node> queue;
+	for (Node& node : nodes) queue.push(node);
+	TEST_ASSERT_FALSE(queue.isEmpty());
+
+	for (Node& node : nodes) {
+		TEST_ASSERT_EQUALS(queue.pop(), &node);
+	}
+	TEST_ASSERT_TRUE(queue.pop() == nullptr);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void
+IntrusiveQueueTest::testInterleaved()
+{
+	Node nodes[3]{1, 2, 3};
+	modm::IntrusiveQueue<Node> queue;
+
+	queue.push(nodes[0]);
+	TEST_ASSERT_EQUALS(queue.pop(), &nodes[0]);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+
+	queue.push(nodes[1]);
+	queue.push(nodes[2]);
+	TEST_ASSERT_EQUALS(queue.pop(), &nodes[1]);
+	queue.push(nodes[0]);
+	TEST_ASSERT_EQUALS(queue.pop(), &nodes[2]);
+	TEST_ASSERT_FALSE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.pop(), &nodes[0]);
+	TEST_ASSERT_TRUE(queue.pop() == nullptr);
+}
+
+void
+IntrusiveQueueTest::testReuse()
+{
+	Node node{1};
+	modm::IntrusiveQueue<Node> queue;
+
+	// the same element can be pushed again once it was popped
+	for (uint8_t ii = 0; ii < 10; ++ii)
+	{
+		queue.push(node);
+		TEST_ASSERT_EQUALS(queue.pop(), &node);
+		TEST_ASSERT_TRUE(queue.isEmpty());
+	}
+}
+
+void
+IntrusiveQueueTest::benchmarkPushPop()
+{
+	static Node nodes[8];
+	modm::IntrusiveQueue<Node> queue;
+	TEST_BENCHMARK("IntrusiveQueue", 1000, {
+		for (Node& node : nodes) queue.push(node);
+		while (Node* node = queue.pop()) unittest::doNotOptimize(node);
+	});
+}
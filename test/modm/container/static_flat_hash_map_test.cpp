@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/static_flat_hash_map.hpp>
+#include <unittest/benchmark.hpp>
+#ifdef MODM_OS_HOSTED
+#include <unordered_map>
+#endif
+
+#include "static_flat_hash_map_test.hpp"
+
+namespace
+{
+	/// forces all keys into the same probe sequence
+	struct CollidingHash
+	{
+		constexpr std::size_t
+		operator () (int16_t) const
+		{ return 0; }
+	};
+
+	enum class
+	Color : uint8_t
+	{
+		Red = 1,
+		Green = 2,
+		Blue = 3,
+	};
+
+	constexpr modm::StaticFlatHashMap<Color, const char*, 3> colors{{
+		{Color::Red, "red"}, {Color::Green, "green"}, {Color::Blue, "blue"},
+	}};
+	static_assert(colors.getSize() == 3);
+	static_assert(colors.contains(Color::Green));
+	static_assert(*colors.find(Color::Blue)[0] == 'b');
+
+	template < std::size_t N >
+	void
+	benchmarkFind()
+	{
+		static modm::StaticFlatHashMap<uint32_t, uint32_t, N> map;
+		for (uint32_t key = 0; key < N; ++key) map.insert(key * 7, key);
+
+		TEST_BENCHMARK("StaticFlatHashMap", 10, {
+			uint32_t sum = 0;
+			for (uint32_t key = 0; key < N; ++key) sum += *map.find(key * 7);
+			unittest::doNotOptimize(sum);
+		});
+#ifdef MODM_OS_HOSTED
+		std::unordered_map<uint32_t, uint32_t> unordered;
+		for (uint32_t key = 0; key < N; ++key) unordered[key * 7] = key;
+
+		TEST_BENCHMARK("std::unordered_map", 10, {
+			uint32_t sum = 0;
+			for (uint32_t key = 0; key < N; ++key) sum += unordered.find(key * 7)->second;
+			unittest::doNotOptimize(sum);
+		});
+#endif
+	}
+}
+
+void
+StaticFlatHashMapTest::testInsertFind()
+{
+	modm::StaticFlatHashMap<int16_t, int16_t, 8> map;
+
+	TEST_ASSERT_TRUE(map.isEmpty());
+	TEST_ASSERT_TRUE(map.find(1) == nullptr);
+	TEST_ASSERT_EQUALS(map.getCapacity(), 8U);
+
+	TEST_ASSERT_TRUE(map.insert(1, 10));
+	TEST_ASSERT_TRUE(map.insert(-5, 50));
+	TEST_ASSERT_FALSE(map.isEmpty());
+	TEST_ASSERT_EQUALS(map.getSize(), 2U);
+	TEST_ASSERT_EQUALS(*map.find(1), 10);
+	TEST_ASSERT_EQUALS(*map.find(-5), 50);
+	TEST_ASSERT_FALSE(map.contains(2));
+
+	// overwrites the value of an existing key
+	TEST_ASSERT_TRUE(map.insert(1, 11));
+	TEST_ASSERT_EQUALS(map.getSize(), 2U);
+	TEST_ASSERT_EQUALS(*map.find(1), 11);
+
+	*map.find(-5) = 55;
+	TEST_ASSERT_EQUALS(*map.find(-5), 55);
+
+	map.clear();
+	TEST_ASSERT_TRUE(map.isEmpty());
+	TEST_ASSERT_FALSE(map.contains(1));
+}
+
+void
+StaticFlatHashMapTest::testFull()
+{
+	modm::StaticFlatHashMap<int16_t, int16_t, 5> map;
+	for (int16_t key = 0; key < 5; ++key) {
+		TEST_ASSERT_TRUE(map.insert(key * 100, key));
+	}
+	TEST_ASSERT_TRUE(map.isFull());
+	TEST_ASSERT_FALSE(map.insert(42, 0));
+	// existing keys can still be assigned
+	TEST_ASSERT_TRUE(map.insert(200, 7));
+	TEST_ASSERT_EQUALS(*map.find(200), 7);
+
+	for (int16_t key = 0; key < 5; ++key) {
+		TEST_ASSERT_TRUE(map.contains(key * 100));
+	}
+}
+
+void
+StaticFlatHashMapTest::testRemove()
+{
+	modm::StaticFlatHashMap<int16_t, int16_t, 32> map;
+	for (int16_t key = 0; key < 32; ++key) map.insert(key, key + 1);
+
+	TEST_ASSERT_FALSE(map.remove(100));
+	for (int16_t key = 0; key < 32; key += 2) {
+		TEST_ASSERT_TRUE(map.remove(key));
+	}
+	TEST_ASSERT_EQUALS(map.getSize(), 16U);
+	for (int16_t key = 0; key < 32; ++key)
+	{
+		if (key & 1) {
+			TEST_ASSERT_EQUALS(*map.find(key), key + 1);
+		} else {
+			TEST_ASSERT_FALSE(map.contains(key));
+		}
+	}
+	// the freed slots are reused
+	for (int16_t key = 100; key < 116; ++key) {
+		TEST_ASSERT_TRUE(map.insert(key, key));
+	}
+	TEST_ASSERT_TRUE(map.isFull());
+}
+
+void
+StaticFlatHashMapTest::testCollisions()
+{
+	modm::StaticFlatHashMap<int16_t, int16_t, 6, CollidingHash> map;
+	for (int16_t key = 1; key <= 6; ++key) map.insert(key, -key);
+
+	for (int16_t key = 1; key <= 6; ++key) {
+		TEST_ASSERT_EQUALS(*map.find(key), -key);
+	}
+	TEST_ASSERT_FALSE(map.contains(7));
+
+	// removing from the middle of the probe sequence shifts the rest back
+	TEST_ASSERT_TRUE(map.remove(3));
+	TEST_ASSERT_TRUE(map.remove(1));
+	TEST_ASSERT_FALSE(map.contains(3));
+	for (int16_t key : {2, 4, 5, 6}) {
+		TEST_ASSERT_EQUALS(*map.find(key), -key);
+	}
+	TEST_ASSERT_TRUE(map.insert(3, 3));
+	TEST_ASSERT_EQUALS(*map.find(3), 3);
+}
+
+void
+StaticFlatHashMapTest::testIterator()
+{
+	modm::StaticFlatHashMap<int16_t, int16_t, 16> map;
+	TEST_ASSERT_TRUE(map.begin() == map.end());
+
+	int16_t sum = 0;
+	for (int16_t key = 1; key <= 10; ++key)
+	{
+		map.insert(key, key * 2);
+		sum += key;
+	}
+	std::size_t count = 0;
+	for (const auto& [key, value] : map)
+	{
+		TEST_ASSERT_EQUALS(value, key * 2);
+		sum -= key;
+		count++;
+	}
+	TEST_ASSERT_EQUALS(count, 10U);
+	TEST_ASSERT_EQUALS(sum, 0);
+	TEST_ASSERT_EQUALS(std::distance(map.begin(), map.end()), 10);
+}
+
+void
+StaticFlatHashMapTest::testConstexpr()
+{
+	TEST_ASSERT_EQUALS(colors.getSize(), 3U);
+	TEST_ASSERT_EQUALS(colors.find(Color::Red)[0][0], 'r');
+	TEST_ASSERT_EQUALS(colors.find(Color::Green)[0][0], 'g');
+	TEST_ASSERT_TRUE(colors.find(Color(4)) == nullptr);
+}
+
+void
+StaticFlatHashMapTest::benchmarkFind16()
+{
+	benchmarkFind<16>();
+}
+
+void
+StaticFlatHashMapTest::benchmarkFind256()
+{
+#ifdef MODM_OS_HOSTED
+	benchmarkFind<256>();
+#endif
+}
+
+void
+StaticFlatHashMapTest::benchmarkFind4096()
+{
+#ifdef MODM_OS_HOSTED
+	benchmarkFind<4096>();
+#endif
+}
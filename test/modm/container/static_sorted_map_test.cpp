@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/static_sorted_map.hpp>
+#include <unittest/benchmark.hpp>
+#ifdef MODM_OS_HOSTED
+#include <map>
+#endif
+
+#include "static_sorted_map_test.hpp"
+
+namespace
+{
+	constexpr modm::StaticSortedMap<uint8_t, uint16_t, 4> dividers{{
+		{48, 1}, {8, 6}, {16, 3}, {8, 7},
+	}};
+	static_assert(dividers.getSize() == 3);
+	static_assert(dividers.begin()->first == 8);
+	static_assert(*dividers.find(8) == 7);
+	static_assert(not dividers.contains(24));
+
+	template < std::size_t N >
+	void
+	benchmarkFind()
+	{
+		static modm::StaticSortedMap<uint32_t, uint32_t, N> map;
+		for (uint32_t key = 0; key < N; ++key) map.insert(key * 7, key);
+
+		TEST_BENCHMARK("StaticSortedMap", 10, {
+			uint32_t sum = 0;
+			for (uint32_t key = 0; key < N; ++key) sum += *map.find(key * 7);
+			unittest::doNotOptimize(sum);
+		});
+#ifdef MODM_OS_HOSTED
+		std::map<uint32_t, uint32_t> ordered;
+		for (uint32_t key = 0; key < N; ++key) ordered[key * 7] = key;
+
+		TEST_BENCHMARK("std::map", 10, {
+			uint32_t sum = 0;
+			for (uint32_t key = 0; key < N; ++key) sum += ordered.find(key * 7)->second;
+			unittest::doNotOptimize(sum);
+		});
+#endif
+	}
+}
+
+void
+StaticSortedMapTest::testInsertFind()
+{
+	modm::StaticSortedMap<int16_t, int16_t, 8> map;
+
+	TEST_ASSERT_TRUE(map.isEmpty());
+	TEST_ASSERT_TRUE(map.find(1) == nullptr);
+	TEST_ASSERT_EQUALS(map.getCapacity(), 8U);
+
+	TEST_ASSERT_TRUE(map.insert(1, 10));
+	TEST_ASSERT_TRUE(map.insert(-5, 50));
+	TEST_ASSERT_EQUALS(map.getSize(), 2U);
+	TEST_ASSERT_EQUALS(*map.find(1), 10);
+	TEST_ASSERT_EQUALS(*map.find(-5), 50);
+	TEST_ASSERT_FALSE(map.contains(0));
+
+	// overwrites the value of an existing key
+	TEST_ASSERT_TRUE(map.insert(1, 11));
+	TEST_ASSERT_EQUALS(map.getSize(), 2U);
+	TEST_ASSERT_EQUALS(*map.find(1), 11);
+
+	*map.find(-5) = 55;
+	TEST_ASSERT_EQUALS(*map.find(-5), 55);
+
+	map.clear();
+	TEST_ASSERT_TRUE(map.isEmpty());
+	TEST_ASSERT_TRUE(map.begin() == map.end());
+}
+
+void
+StaticSortedMapTest::testOrder()
+{
+	modm::StaticSortedMap<int16_t, int16_t, 8> map;
+	for (int16_t key : {5, -3, 7, 0, 2}) map.insert(key, key);
+
+	int16_t previous = -100;
+	for (const auto& [key, value] : map)
+	{
+		TEST_ASSERT_TRUE(previous < key);
+		TEST_ASSERT_EQUALS(value, key);
+		previous = key;
+	}
+	TEST_ASSERT_EQUALS(map.begin()->first, -3);
+	TEST_ASSERT_EQUALS((map.end() - 1)->first, 7);
+}
+
+void
+StaticSortedMapTest::testFull()
+{
+	modm::StaticSortedMap<int16_t, int16_t, 3> map;
+	TEST_ASSERT_TRUE(map.insert(3, 3));
+	TEST_ASSERT_TRUE(map.insert(1, 1));
+	TEST_ASSERT_TRUE(map.insert(2, 2));
+	TEST_ASSERT_TRUE(map.isFull());
+	TEST_ASSERT_FALSE(map.insert(0, 0));
+	TEST_ASSERT_TRUE(map.insert(2, 4));
+	TEST_ASSERT_EQUALS(*map.find(2), 4);
+	TEST_ASSERT_EQUALS(map.begin()->first, 1);
+}
+
+void
+StaticSortedMapTest::testRemove()
+{
+	modm::StaticSortedMap<int16_t, int16_t, 8> map;
+	for (int16_t key = 0; key < 8; ++key) map.insert(key, key);
+
+	TEST_ASSERT_FALSE(map.remove(8));
+	TEST_ASSERT_TRUE(map.remove(0));
+	TEST_ASSERT_TRUE(map.remove(4));
+	TEST_ASSERT_TRUE(map.remove(7));
+	TEST_ASSERT_EQUALS(map.getSize(), 5U);
+
+	const int16_t expected[] = {1, 2, 3, 5, 6};
+	std::size_t index = 0;
+	for (const auto& element : map) {
+		TEST_ASSERT_EQUALS(element.first, expected[index++]);
+	}
+	TEST_ASSERT_FALSE(map.contains(4));
+}
+
+void
+StaticSortedMapTest::testBounds()
+{
+	modm::StaticSortedMap<int16_t, int16_t, 8> map;
+	for (int16_t key : {10, 20, 30}) map.insert(key, key);
+
+	TEST_ASSERT_EQUALS(map.lowerBound(20)->first, 20);
+	TEST_ASSERT_EQUALS(map.upperBound(20)->first, 30);
+	TEST_ASSERT_EQUALS(map.lowerBound(15)->first, 20);
+	TEST_ASSERT_TRUE(map.lowerBound(5) == map.begin());
+	TEST_ASSERT_TRUE(map.upperBound(30) == map.end());
+}
+
+void
+StaticSortedMapTest::testConstexpr()
+{
+	TEST_ASSERT_EQUALS(dividers.getSize(), 3U);
+	TEST_ASSERT_EQUALS(*dividers.find(16), 3U);
+	TEST_ASSERT_EQUALS(*dividers.find(48), 1U);
+	TEST_ASSERT_TRUE(dividers.find(9) == nullptr);
+}
+
+void
+StaticSortedMapTest::benchmarkFind16()
+{
+	benchmarkFind<16>();
+}
+
+void
+StaticSortedMapTest::benchmarkFind256()
+{
+#ifdef MODM_OS_HOSTED
+	benchmarkFind<256>();
+#endif
+}
+
+void
+StaticSortedMapTest::benchmarkFind4096()
+{
+#ifdef MODM_OS_HOSTED
+	benchmarkFind<4096>();
+#endif
+}
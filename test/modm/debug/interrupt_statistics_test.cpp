@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "interrupt_statistics_test.hpp"
+
+#include <modm/debug/interrupt/statistics.hpp>
+
+using Statistics = modm::InterruptStatistics<8, 2>;
+
+void
+InterruptStatisticsTest::testSingle()
+{
+	Statistics stats;
+	TEST_ASSERT_EQUALS(stats.size(), 8u);
+	TEST_ASSERT_EQUALS(stats[3].count, 0u);
+	TEST_ASSERT_EQUALS(stats[3].averageCycles(), 0u);
+
+	stats.enter(3, 100);
+	TEST_ASSERT_EQUALS(stats.getDepth(), 1u);
+	stats.exit(150);
+	stats.enter(3, 200);
+	stats.exit(220);
+	stats.enter(5, 300);
+	stats.exit(301);
+
+	TEST_ASSERT_EQUALS(stats.getDepth(), 0u);
+	TEST_ASSERT_EQUALS(stats[3].count, 2u);
+	TEST_ASSERT_EQUALS(stats[3].maxCycles, 50u);
+	TEST_ASSERT_EQUALS(stats[3].totalCycles, 70u);
+	TEST_ASSERT_EQUALS(stats[3].averageCycles(), 35u);
+	TEST_ASSERT_EQUALS(stats[3].maxDepth, 1u);
+	TEST_ASSERT_EQUALS(stats[3].nested, 0u);
+	TEST_ASSERT_EQUALS(stats[5].count, 1u);
+	TEST_ASSERT_EQUALS(stats.getBusyCycles(), 71u);
+	TEST_ASSERT_EQUALS(stats.getMaxDepth(), 1u);
+
+	// unbalanced exit is ignored
+	stats.exit(400);
+	TEST_ASSERT_EQUALS(stats.getBusyCycles(), 71u);
+}
+
+void
+InterruptStatisticsTest::testNested()
+{
+	Statistics stats;
+	stats.enter(1, 100);
+	stats.enter(2, 110);	// preempts 1 after 10 cycles
+	stats.exit(140);		// 2 ran for 30 cycles
+	stats.enter(2, 150);	// tail-chained preemption after another 10 cycles
+	stats.exit(155);
+	stats.exit(175);		// 1 ran for another 20 cycles
+
+	TEST_ASSERT_EQUALS(stats[1].count, 1u);
+	TEST_ASSERT_EQUALS(stats[1].maxCycles, 40u);
+	TEST_ASSERT_EQUALS(stats[1].maxDepth, 1u);
+	TEST_ASSERT_EQUALS(stats[1].nested, 0u);
+	TEST_ASSERT_EQUALS(stats[2].count, 2u);
+	TEST_ASSERT_EQUALS(stats[2].maxCycles, 30u);
+	TEST_ASSERT_EQUALS(stats[2].totalCycles, 35u);
+	TEST_ASSERT_EQUALS(stats[2].maxDepth, 2u);
+	TEST_ASSERT_EQUALS(stats[2].nested, 2u);
+	// the busy time is the wall time of the outermost interrupt
+	TEST_ASSERT_EQUALS(stats.getBusyCycles(), 75u);
+	TEST_ASSERT_EQUALS(stats.getMaxDepth(), 2u);
+}
+
+void
+InterruptStatisticsTest::testOverflow()
+{
+	Statistics stats;
+	stats.enter(1, 0);
+	stats.enter(2, 10);
+	stats.enter(3, 20);	// not tracked
+	TEST_ASSERT_EQUALS(stats.getDepth(), 3u);
+	stats.exit(30);
+	stats.exit(40);
+	stats.exit(50);
+
+	TEST_ASSERT_EQUALS(stats.getOverflows(), 1u);
+	TEST_ASSERT_EQUALS(stats[3].count, 0u);
+	// the untracked interrupt is accounted to the interrupt it preempted
+	TEST_ASSERT_EQUALS(stats[2].totalCycles, 30u);
+	TEST_ASSERT_EQUALS(stats[1].totalCycles, 20u);
+	TEST_ASSERT_EQUALS(stats.getMaxDepth(), 2u);
+}
+
+void
+InterruptStatisticsTest::testTimestampWrap()
+{
+	Statistics stats;
+	stats.enter(4, 0xffff'fff0);
+	stats.enter(5, 0xffff'fffa);
+	stats.exit(0x0000'0004);
+	stats.exit(0x0000'0010);
+
+	TEST_ASSERT_EQUALS(stats[5].maxCycles, 10u);
+	TEST_ASSERT_EQUALS(stats[4].maxCycles, 22u);
+	TEST_ASSERT_EQUALS(stats.getBusyCycles(), 32u);
+}
+
+void
+InterruptStatisticsTest::testReset()
+{
+	Statistics stats;
+	stats.enter(1, 0);
+	stats.exit(10);
+	stats.enter(1, 20);
+	stats.reset();
+	TEST_ASSERT_EQUALS(stats[1].count, 0u);
+	TEST_ASSERT_EQUALS(stats.getBusyCycles(), 0u);
+	TEST_ASSERT_EQUALS(stats.getMaxDepth(), 1u);
+
+	// the active interrupt is still completed
+	stats.exit(25);
+	TEST_ASSERT_EQUALS(stats[1].count, 1u);
+	TEST_ASSERT_EQUALS(stats[1].maxCycles, 5u);
+}
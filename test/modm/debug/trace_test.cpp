@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "trace_test.hpp"
+
+#include <modm/debug/trace/trace.hpp>
+#include <modm-test/mock/clock.hpp>
+#include <cstdio>
+
+using test_clock = modm_test::chrono::micro_clock;
+using Buffer = modm::trace::Buffer;
+using modm::trace::Id;
+
+static constexpr const char* path = "modm_trace_test.bin";
+
+void
+TraceTest::setUp()
+{
+	std::remove(path);
+	test_clock::setTime(1000);
+}
+
+void
+TraceTest::tearDown()
+{
+	std::remove(path);
+}
+
+void
+TraceTest::testRecord()
+{
+	TEST_ASSERT_FALSE(modm::trace::initialize(path));
+	TEST_ASSERT_EQUALS(modm::trace::buffer->magic, Buffer::Magic);
+	TEST_ASSERT_EQUALS(modm::trace::buffer->frequency, 1'000'000ul);
+	// the reset event is always recorded
+	TEST_ASSERT_EQUALS(modm::trace::size(), 1u);
+	TEST_ASSERT_EQUALS(modm::trace::get(0).id(), uint16_t(Id::Reset));
+	TEST_ASSERT_EQUALS(modm::trace::get(0).arg0, 1u);
+
+	test_clock::setTime(2000);
+	modm::trace::record(42, 0x12345678, 0xdeadbeef);
+	test_clock::setTime(3000);
+	modm::trace::record(43);
+
+	TEST_ASSERT_EQUALS(modm::trace::size(), 3u);
+	const auto& event = modm::trace::get(1);
+	TEST_ASSERT_EQUALS(event.timestamp, 2000u);
+	TEST_ASSERT_EQUALS(event.id(), 42u);
+	TEST_ASSERT_EQUALS(event.sequence(), 1u);
+	TEST_ASSERT_EQUALS(event.arg0, 0x12345678u);
+	TEST_ASSERT_EQUALS(event.arg1, 0xdeadbeefu);
+	TEST_ASSERT_EQUALS(modm::trace::get(2).timestamp, 3000u);
+	TEST_ASSERT_EQUALS(modm::trace::get(2).id(), 43u);
+	TEST_ASSERT_EQUALS(modm::trace::get(2).arg0, 0u);
+
+	modm::trace::clear();
+	TEST_ASSERT_EQUALS(modm::trace::size(), 0u);
+}
+
+void
+TraceTest::testWrapAround()
+{
+	modm::trace::initialize(path);
+	modm::trace::clear();
+	for (uint32_t ii = 0; ii < Buffer::Capacity + 3; ++ii)
+		modm::trace::record(ii, ii);
+
+	TEST_ASSERT_EQUALS(modm::trace::size(), size_t(Buffer::Capacity));
+	TEST_ASSERT_EQUALS(modm::trace::get(0).id(), 3u);
+	TEST_ASSERT_EQUALS(modm::trace::get(0).sequence(), 3u);
+	TEST_ASSERT_EQUALS(modm::trace::get(Buffer::Capacity - 1).arg0, Buffer::Capacity + 2u);
+}
+
+void
+TraceTest::testPersistence()
+{
+	modm::trace::initialize(path);
+	modm::trace::record(1, 11);
+	modm::trace::record(2, 22);
+
+	// simulates a restart of the program
+	test_clock::setTime(10);
+	TEST_ASSERT_TRUE(modm::trace::initialize(path));
+	TEST_ASSERT_EQUALS(modm::trace::size(), 4u);
+	TEST_ASSERT_EQUALS(modm::trace::get(1).id(), 1u);
+	TEST_ASSERT_EQUALS(modm::trace::get(2).arg0, 22u);
+	TEST_ASSERT_EQUALS(modm::trace::get(3).id(), uint16_t(Id::Reset));
+	TEST_ASSERT_EQUALS(modm::trace::get(3).arg0, 0u);
+	TEST_ASSERT_EQUALS(modm::trace::get(3).timestamp, 10u);
+
+	// the file contains the raw buffer
+	Buffer copy{};
+	FILE* file = std::fopen(path, "rb");
+	TEST_ASSERT_TRUE(file != nullptr);
+	if (file == nullptr) return;
+	TEST_ASSERT_EQUALS(std::fread(&copy, sizeof(copy), 1, file), 1u);
+	std::fclose(file);
+	TEST_ASSERT_EQUALS(copy.magic, Buffer::Magic);
+	TEST_ASSERT_EQUALS(uint32_t(copy.head), 4u);
+	TEST_ASSERT_EQUALS(copy.events[1].arg0, 11u);
+}
+
+void
+TraceTest::testCorrupted()
+{
+	modm::trace::initialize(path);
+	modm::trace::record(1);
+	modm::trace::buffer->capacity = Buffer::Capacity / 2;
+
+	TEST_ASSERT_FALSE(modm::trace::initialize(path));
+	TEST_ASSERT_EQUALS(modm::trace::size(), 1u);
+	TEST_ASSERT_EQUALS(modm::trace::buffer->capacity, Buffer::Capacity);
+}
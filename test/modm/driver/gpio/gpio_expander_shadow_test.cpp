@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "gpio_expander_shadow_test.hpp"
+
+#include <modm/driver/gpio/pca9535.hpp>
+#include <modm-test/mock/i2c_master.hpp>
+
+using I2cMaster = modm_test::platform::I2cMaster;
+using Expander = modm::Pca9535<I2cMaster>;
+using Pin = Expander::Pin;
+
+namespace
+{
+
+Expander animation;
+Expander blocking;
+Expander redundant;
+Expander explicitly;
+Expander failing;
+Expander interrupted;
+Expander directions;
+Expander inputs;
+
+// one pin of the expander per LED
+template< Expander &expander, template< Expander &, Pin > class Gpio >
+struct Leds
+{
+	static void
+	frame(uint8_t index)
+	{
+		// running light on port 0
+		[&]<uint8_t... Led>(std::integer_sequence<uint8_t, Led...>)
+		{
+			(Gpio< expander, Pin(1u << Led) >::set(Led == index), ...);
+		}(std::make_integer_sequence<uint8_t, 8>());
+		// heartbeat on port 1
+		Gpio< expander, Pin::P1_0 >::toggle();
+	}
+};
+
+template< Expander &expander, Pin pin >
+using BlockingPin = modm::GpioExpanderPin< Expander, expander, pin >;
+
+uint16_t
+txData()
+{
+	const auto &tx = I2cMaster::getTxBuffer();
+	if (tx.size() != 3) return 0xdead;
+	return tx[1] | (tx[2] << 8);
+}
+
+}
+
+void
+GpioExpanderShadowTest::setUp()
+{
+	I2cMaster::clear();
+}
+
+void
+GpioExpanderShadowTest::testAnimationFrame()
+{
+	using Shadow = Expander::Shadow< animation >;
+	using AnimationLeds = Leds< animation, Expander::ShadowPin >;
+
+	for (uint8_t index = 0; index < 16; index++)
+	{
+		const std::size_t transactions = I2cMaster::getTransactionCount();
+		AnimationLeds::frame(index % 8);
+		// no bus access until the frame is complete
+		TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), transactions);
+		TEST_ASSERT_TRUE(Shadow::isDirty());
+
+		Shadow::flush();
+		// all LEDs are written in one transaction
+		TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), transactions + 1);
+		TEST_ASSERT_FALSE(Shadow::isDirty());
+		TEST_ASSERT_EQUALS(I2cMaster::getAddress(), 0x20);
+		TEST_ASSERT_EQUALS(I2cMaster::getTxBuffer()[0], 0x02 /* OutputPort0 */);
+		TEST_ASSERT_EQUALS(txData(), uint16_t((1u << (index % 8)) | ((index & 1) ? 0 : 0x100)));
+		TEST_ASSERT_EQUALS(animation.getOutputs().value, txData());
+	}
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 16u);
+
+	// the same animation without shadow registers
+	using BlockingLeds = Leds< blocking, BlockingPin >;
+	I2cMaster::clear();
+	for (uint8_t index = 0; index < 16; index++)
+	{
+		BlockingLeds::frame(index % 8);
+	}
+	// every pin write is one transaction
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 16u * 9u);
+}
+
+void
+GpioExpanderShadowTest::testRedundantWrites()
+{
+	using Shadow = Expander::Shadow< redundant >;
+	using Led = Expander::ShadowPin< redundant, Pin::P0_3 >;
+
+	// writing the current output level does not dirty the shadow
+	Led::reset();
+	TEST_ASSERT_FALSE(Shadow::isDirty());
+	TEST_ASSERT_TRUE(Shadow::flush());
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 0u);
+
+	Led::set();
+	TEST_ASSERT_TRUE(Led::isSet());
+	TEST_ASSERT_FALSE(redundant.isSet(Pin::P0_3));
+	TEST_ASSERT_TRUE(Shadow::flush());
+	TEST_ASSERT_EQUALS(txData(), 0x0008);
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 1u);
+	TEST_ASSERT_TRUE(redundant.isSet(Pin::P0_3));
+
+	Led::set();
+	TEST_ASSERT_FALSE(Shadow::isDirty());
+	// the last write of a pin wins
+	Led::reset();
+	Led::toggle();
+	Led::toggle();
+	TEST_ASSERT_FALSE(Led::isSet());
+	TEST_ASSERT_EQUALS(Shadow::getOutputs(), 0x0000);
+}
+
+void
+GpioExpanderShadowTest::testExplicitFlush()
+{
+	using Shadow = Expander::Shadow< explicitly >;
+
+	Shadow::set(Pin::P0_1 | Pin::P1_7);
+	Shadow::set(Pin::P0_2, true);
+	Shadow::reset(Pin::P0_1);
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 0u);
+
+	TEST_ASSERT_TRUE(Shadow::flush());
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 1u);
+	TEST_ASSERT_EQUALS(txData(), 0x8004);
+
+	// flushing without changes does not access the bus
+	TEST_ASSERT_TRUE(Shadow::flush());
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 1u);
+
+	Shadow::toggle(Pin::P0_2 | Pin::P0_3);
+	TEST_ASSERT_TRUE(Shadow::flush());
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 2u);
+	TEST_ASSERT_EQUALS(txData(), 0x8008);
+}
+
+void
+GpioExpanderShadowTest::testFailedFlush()
+{
+	using Shadow = Expander::Shadow< failing >;
+
+	Shadow::set(Pin::P0_0 | Pin::P0_7);
+	I2cMaster::setNextError(I2cMaster::Error::AddressNack);
+	TEST_ASSERT_FALSE(Shadow::flush());
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 1u);
+	// the outputs are written again on the next flush
+	TEST_ASSERT_TRUE(Shadow::isDirty());
+	TEST_ASSERT_EQUALS(Shadow::getOutputs(), 0x0081);
+
+	Shadow::reset(Pin::P0_0);
+	TEST_ASSERT_TRUE(Shadow::flush());
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 2u);
+	TEST_ASSERT_EQUALS(txData(), 0x0080);
+	TEST_ASSERT_FALSE(Shadow::isDirty());
+}
+
+void
+GpioExpanderShadowTest::testWriteDuringFailedFlush()
+{
+	using Shadow = Expander::Shadow< interrupted >;
+
+	Shadow::set(Pin::P0_0 | Pin::P0_1);
+	// an interrupt writes pins while the transfer fails
+	I2cMaster::setStartCallback([]
+	{
+		Shadow::set(Pin::P0_2);
+		Shadow::reset(Pin::P0_0);
+	});
+	I2cMaster::setNextError(I2cMaster::Error::AddressNack);
+	TEST_ASSERT_FALSE(Shadow::flush());
+	TEST_ASSERT_TRUE(Shadow::isDirty());
+	// the pins written during the transfer are kept
+	TEST_ASSERT_EQUALS(Shadow::getOutputs(), 0x0006);
+
+	I2cMaster::setStartCallback(nullptr);
+	TEST_ASSERT_TRUE(Shadow::flush());
+	TEST_ASSERT_EQUALS(txData(), 0x0006);
+	TEST_ASSERT_FALSE(Shadow::isDirty());
+}
+
+void
+GpioExpanderShadowTest::testInputPins()
+{
+	using Shadow = Expander::Shadow< directions >;
+
+	Shadow::set(Pin::P0_0 | Pin::P0_1);
+	TEST_ASSERT_TRUE(Shadow::flush());
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(directions.setInput(Pin::P0_1 | Pin::P0_2)));
+	I2cMaster::clear();
+
+	// writes to input pins are ignored
+	Shadow::reset(Pin::P0_1);
+	Shadow::set(Pin::P0_2);
+	TEST_ASSERT_FALSE(Shadow::isDirty());
+	Shadow::toggle(Pin::P0_0 | Pin::P0_1 | Pin::P0_2);
+	TEST_ASSERT_TRUE(Shadow::flush());
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 1u);
+	TEST_ASSERT_EQUALS(txData(), 0x0002);
+}
+
+void
+GpioExpanderShadowTest::testInputCaching()
+{
+	using Shadow = Expander::Shadow< inputs >;
+	using Button = Expander::ShadowPin< inputs, Pin::P1_1 >;
+	using Led = Expander::ShadowPin< inputs, Pin::P0_0 >;
+
+	// the inputs are read on the first update
+	TEST_ASSERT_TRUE(Shadow::isStale());
+	const uint8_t pressed[] = {0x00, 0x02};
+	I2cMaster::appendRxBuffer(pressed, 2);
+	TEST_ASSERT_TRUE(Shadow::update());
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 1u);
+	TEST_ASSERT_EQUALS(I2cMaster::getTxBuffer().size(), 1u);
+	TEST_ASSERT_EQUALS(I2cMaster::getTxBuffer()[0], 0x00 /* InputPort0 */);
+	TEST_ASSERT_FALSE(Shadow::isStale());
+
+	// reading the buffered inputs does not access the bus
+	for (uint8_t frame = 0; frame < 10; frame++)
+	{
+		TEST_ASSERT_TRUE(Button::read());
+		TEST_ASSERT_TRUE(Shadow::update());
+	}
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 1u);
+
+	// the interrupt of the expander invalidates the inputs
+	const uint8_t released[] = {0x00, 0x00};
+	I2cMaster::appendRxBuffer(released, 2);
+	Shadow::invalidateInputs();
+	TEST_ASSERT_TRUE(Button::read());
+	Led::set();
+	TEST_ASSERT_TRUE(Shadow::update());
+	// one write and one read transaction
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 3u);
+	TEST_ASSERT_FALSE(Button::read());
+	TEST_ASSERT_TRUE(inputs.isSet(Pin::P0_0));
+
+	// a failed read is repeated on the next update
+	Shadow::invalidateInputs();
+	I2cMaster::setNextError(I2cMaster::Error::AddressNack);
+	TEST_ASSERT_FALSE(Shadow::update());
+	TEST_ASSERT_TRUE(Shadow::isStale());
+	I2cMaster::appendRxBuffer(pressed, 2);
+	TEST_ASSERT_TRUE(Shadow::update());
+	TEST_ASSERT_EQUALS(I2cMaster::getTransactionCount(), 5u);
+	TEST_ASSERT_TRUE(Button::read());
+}
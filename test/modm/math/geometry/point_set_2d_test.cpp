@@ -2,7 +2,7 @@
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009, Thorsten Lajewski
  * Copyright (c) 2009-2011, Fabian Greif
- * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2012, 2026, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
  *
  * This file is part of the modm project.
@@ -14,6 +14,7 @@
 // ----------------------------------------------------------------------------
 
 #include <modm/math/geometry/point_set_2d.hpp>
+#include <unittest/benchmark.hpp>
 
 #include "point_set_2d_test.hpp"
 
@@ -78,3 +79,28 @@ PointSet2DTest::testIterator()
 
 	TEST_ASSERT_EQUALS(count, 3);
 }
+
+void
+PointSet2DTest::benchmarkAppend10k()
+{
+#ifdef MODM_OS_HOSTED
+	TEST_BENCHMARK("append 10k", 1, {
+		modm::PointSet2D<int16_t> set;
+		for (int16_t ii = 0; ii < 10000; ++ii) set.append({ii, int16_t(-ii)});
+		unittest::doNotOptimize(set[9999]);
+	});
+#endif
+}
+
+void
+PointSet2DTest::benchmarkAppend10kReserved()
+{
+#ifdef MODM_OS_HOSTED
+	TEST_BENCHMARK("append 10k reserved", 1, {
+		modm::PointSet2D<int16_t> set(0);
+		set.reserve(10000);
+		for (int16_t ii = 0; ii < 10000; ++ii) set.append({ii, int16_t(-ii)});
+		unittest::doNotOptimize(set[9999]);
+	});
+#endif
+}
@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2010, Fabian Greif
- * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2012, 2026, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
  *
  * This file is part of the modm project.
@@ -29,4 +29,10 @@ public:
 
 	void
 	testIterator();
+
+	void
+	benchmarkAppend10k();
+
+	void
+	benchmarkAppend10kReserved();
 };
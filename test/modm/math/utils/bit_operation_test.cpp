@@ -12,6 +12,8 @@
 
 #include <modm/math/utils/bit_operation.hpp>
 
+#include <unittest/benchmark.hpp>
+
 #include "bit_operation_test.hpp"
 
 void
@@ -142,3 +144,23 @@ BitOperationTest::testCount32bit()
 	TEST_ASSERT_EQUALS(modm::bitCount(static_cast<uint32_t>(0x55555555)), 16U);
 	TEST_ASSERT_EQUALS(modm::bitCount(static_cast<uint32_t>(0xffffffff)), 32U);
 }
+
+void
+BitOperationTest::benchmarkReverse32bit()
+{
+	uint32_t value = 0x12345678;
+	TEST_BENCHMARK("bitReverse32", 100, {
+		value = modm::bitReverse(value) + 1;
+		unittest::doNotOptimize(value);
+	});
+}
+
+void
+BitOperationTest::benchmarkCount32bit()
+{
+	uint32_t value = 0x12345678;
+	TEST_BENCHMARK("bitCount32", 100, {
+		value += modm::bitCount(value);
+		unittest::doNotOptimize(value);
+	});
+}
@@ -37,4 +37,10 @@ public:
 
 	void
 	testCount32bit();
+
+	void
+	benchmarkReverse32bit();
+
+	void
+	benchmarkCount32bit();
 };
@@ -59,6 +59,30 @@ modm_test::platform::CanDriver::sendMessage(const modm::can::Message& message)
 	}
 }
 
+std::size_t
+modm_test::platform::CanDriver::getMessages(std::span<modm::can::Message> messages)
+{
+	std::size_t count = 0;
+	for (modm::can::Message& message : messages)
+	{
+		if (not getMessage(message)) break;
+		count++;
+	}
+	return count;
+}
+
+std::size_t
+modm_test::platform::CanDriver::sendMessages(std::span<const modm::can::Message> messages)
+{
+	std::size_t count = 0;
+	for (const modm::can::Message& message : messages)
+	{
+		if (not sendMessage(message)) break;
+		count++;
+	}
+	return count;
+}
+
 uint8_t
 modm_test::platform::CanDriver::getReceiveErrorCounter()
 {
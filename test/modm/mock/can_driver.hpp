@@ -17,6 +17,7 @@
 
 #include <modm/architecture/interface/can.hpp>
 #include <modm/container/linked_list.hpp>
+#include <span>
 
 namespace modm_test
 {
@@ -46,6 +47,12 @@ public:
 	bool
 	sendMessage(const modm::can::Message& message);
 
+	std::size_t
+	getMessages(std::span<modm::can::Message> messages);
+
+	std::size_t
+	sendMessages(std::span<const modm::can::Message> messages);
+
 	static uint8_t
 	getReceiveErrorCounter();
 
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <modm/architecture/interface/gpio.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace modm_test
+{
+
+/**
+ * Records the level changes of mocked GPIOs over a virtual time.
+ *
+ * The virtual time only advances by calling `delay_ns()`, which can be used
+ * as the delay function of the software peripherals. The channels use the
+ * format of `modm::GpioSampler::Channel` with nanoseconds as time base, so
+ * that they can be verified with the `LogicAnalyzer` on hosted targets.
+ *
+ * @ingroup modm_test_mock_logic_analyzer
+ */
+class GpioRecorder
+{
+public:
+	using Type = uint32_t;
+	static constexpr std::size_t Channels = 8;
+
+	class Channel
+	{
+		friend class GpioRecorder;
+		std::vector<Type> data;
+
+		void
+		add(Type time, bool level)
+		{ data.push_back((time & ~Type(1)) | level); }
+
+	public:
+		/// Samples per second
+		static constexpr uint32_t Frequency = 1'000'000'000;
+
+		size_t max() const { return data.size(); }
+		size_t size() const { return data.size(); }
+
+		Type
+		diff(size_t index) const
+		{
+			if (index == 0) return 0;
+			return (*this)[index] - (*this)[index - 1];
+		}
+
+		bool
+		read(size_t index) const
+		{ return (*this)[index] & 1; }
+
+		Type
+		operator[](size_t index) const
+		{
+			if (data.empty()) return 0;
+			return data[(index < data.size()) ? index : (data.size() - 1)];
+		}
+
+		const Type* begin() const { return data.data(); }
+		const Type* end() const { return data.data() + data.size(); }
+	};
+
+	/**
+	 * Mocked GPIO recorded in a channel.
+	 *
+	 * Reading returns the output level, unless an `input` function is set to
+	 * model other devices driving the line.
+	 */
+	template< std::size_t Index >
+	class Gpio : public ::modm::GpioIO
+	{
+		static_assert(Index < Channels, "GpioRecorder only has a limited number of channels!");
+		static inline bool level{false};
+
+	public:
+		static constexpr std::size_t channelIndex = Index;
+		static inline bool (*input)() = nullptr;
+
+		static void setOutput() {}
+		static void setOutput(bool value) { set(value); }
+		static void setInput() {}
+
+		static void
+		set(bool value)
+		{
+			if (value == level) return;
+			level = value;
+			channels[Index].add(time, value);
+		}
+
+		static void set() { set(true); }
+		static void reset() { set(false); }
+		static void toggle() { set(not level); }
+		static bool isSet() { return level; }
+
+		static bool
+		read()
+		{ return input ? input() : level; }
+
+		static const Channel&
+		channel()
+		{ return channels[Index]; }
+	};
+
+	/// Advances the virtual time
+	static void
+	delay_ns(uint32_t ns)
+	{ time += ns; }
+
+	static Type
+	now()
+	{ return time; }
+
+	/// Clears all channels and records the current level of the GPIOs at time zero.
+	template< class... Gpios >
+	static void
+	restart()
+	{
+		time = 0;
+		for (auto &channel : channels) channel.data.clear();
+		(channels[Gpios::channelIndex].add(0, Gpios::isSet()), ...);
+	}
+
+private:
+	static inline Type time{0};
+	static inline std::array<Channel, Channels> channels{};
+};
+
+} // namespace modm_test
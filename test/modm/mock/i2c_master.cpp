@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "i2c_master.hpp"
+
+// ----------------------------------------------------------------------------
+
+bool
+modm_test::platform::I2cMaster::start(modm::I2cTransaction *transaction, ConfigurationHandler handler)
+{
+	if (not transaction) return false;
+	if (not transaction->attaching())
+	{
+		transaction->detaching(modm::I2c::DetachCause::FailedToAttach);
+		return false;
+	}
+	if (handler) handler();
+
+	transactionCount++;
+	if (startCallback) startCallback();
+	txBuffer.clear();
+	errorState = nextError;
+	nextError = Error::NoError;
+
+	modm::I2cTransaction::Starting starting = transaction->starting();
+	address = starting.address >> 1;
+	if (errorState != Error::NoError)
+	{
+		transaction->detaching(modm::I2c::DetachCause::ErrorCondition);
+		return true;
+	}
+
+	auto operation = static_cast<modm::I2c::Operation>(starting.next);
+	while (true)
+	{
+		switch (operation)
+		{
+			case modm::I2c::Operation::Write:
+			{
+				const modm::I2cTransaction::Writing writing = transaction->writing();
+				txBuffer.insert(txBuffer.end(), writing.buffer, writing.buffer + writing.length);
+				operation = static_cast<modm::I2c::Operation>(writing.next);
+				break;
+			}
+			case modm::I2c::Operation::Read:
+			{
+				const modm::I2cTransaction::Reading reading = transaction->reading();
+				for (std::size_t index = 0; index < reading.length; index++)
+				{
+					if (rxBuffer.isEmpty()) {
+						reading.buffer[index] = 0xff;
+					}
+					else {
+						reading.buffer[index] = rxBuffer.getFront();
+						rxBuffer.removeFront();
+					}
+				}
+				operation = static_cast<modm::I2c::Operation>(reading.next);
+				break;
+			}
+			case modm::I2c::Operation::Restart:
+				starting = transaction->starting();
+				operation = static_cast<modm::I2c::Operation>(starting.next);
+				break;
+
+			default:
+			case modm::I2c::Operation::Stop:
+				transaction->detaching(modm::I2c::DetachCause::NormalStop);
+				return true;
+		}
+	}
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_TEST_MOCK_I2C_MASTER_HPP
+#define MODM_TEST_MOCK_I2C_MASTER_HPP
+
+#include <modm/architecture/interface/i2c_master.hpp>
+#include <modm/architecture/interface/i2c_transaction.hpp>
+#include <modm/container/deque.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace modm_test
+{
+
+namespace platform
+{
+
+/**
+ * Mock I2C master for unittests.
+ *
+ * Transactions are executed completely inside `start()`, so that drivers
+ * finish their bus accesses without a scheduler. The master counts the
+ * transactions, records the bytes written by the last transaction and
+ * returns the bytes appended to the receive buffer for read operations.
+ *
+ * @ingroup modm_test_mock_i2c_master
+ */
+class I2cMaster : public modm::I2cMaster
+{
+	static inline std::size_t transactionCount{0};
+	static inline uint8_t address{0};
+	static inline std::vector<uint8_t> txBuffer;
+	static inline modm::BoundedDeque<uint8_t, 16> rxBuffer;
+	static inline Error errorState{Error::NoError};
+	static inline Error nextError{Error::NoError};
+	static inline void (*startCallback)(){nullptr};
+
+public:
+	static bool
+	start(modm::I2cTransaction *transaction, ConfigurationHandler handler = nullptr);
+
+	static void
+	reset()
+	{
+	}
+
+	static Error
+	getErrorState()
+	{
+		return errorState;
+	}
+
+public:
+	/// Number of transactions started since the last `clear()`
+	static std::size_t
+	getTransactionCount()
+	{
+		return transactionCount;
+	}
+
+	/// Slave address of the last transaction
+	static uint8_t
+	getAddress()
+	{
+		return address;
+	}
+
+	/// Bytes written by the last transaction
+	static const std::vector<uint8_t>&
+	getTxBuffer()
+	{
+		return txBuffer;
+	}
+
+	/// Bytes returned by the following read operations, reads 0xff when empty.
+	/// At most 16 bytes are buffered, additional bytes are dropped.
+	static void
+	appendRxBuffer(const uint8_t *data, std::size_t length)
+	{
+		for (std::size_t index = 0; index < length; index++)
+			rxBuffer.append(data[index]);
+	}
+
+	/// Fails the next transaction with this error
+	static void
+	setNextError(Error error)
+	{
+		nextError = error;
+	}
+
+	/// Called at the start of every transaction, e.g. to simulate an interrupt
+	static void
+	setStartCallback(void (*callback)())
+	{
+		startCallback = callback;
+	}
+
+	static void
+	clear()
+	{
+		transactionCount = 0;
+		address = 0;
+		txBuffer.clear();
+		rxBuffer.clear();
+		errorState = Error::NoError;
+		nextError = Error::NoError;
+		startCallback = nullptr;
+	}
+};
+
+} // namespace platform
+
+} // namespace modm_test
+
+#endif // MODM_TEST_MOCK_I2C_MASTER_HPP
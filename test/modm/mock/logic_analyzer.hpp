@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Niklas Hauser
+ * Copyright (c) 2018, 2026, Niklas Hauser
  *
  * This file is part of the modm project.
  *
@@ -11,7 +11,10 @@
 
 #pragma once
 
-#include <modm/driver/gpio_sampler.hpp>
+#if __has_include(<modm/driver/gpio_sampler.hpp>)
+#	include <modm/driver/gpio_sampler.hpp>
+#endif
+#include "gpio_recorder.hpp"
 #include <stdlib.h>
 #include <limits.h>
 #include <functional>
@@ -20,17 +23,28 @@
 namespace modm_test
 {
 
-/// @ingroup modm_test_mock_logic_analyzer
+/**
+ * Verifies the samples of a channel against a state machine.
+ *
+ * The channel is either a `modm::GpioSampler::Channel` with the time in CPU
+ * cycles or a `GpioRecorder::Channel` with the time in nanoseconds.
+ * Timings in the state machine are given in microseconds.
+ *
+ * @returns `false` if any of the samples did not match.
+ * @ingroup modm_test_mock_logic_analyzer
+ */
 class LogicAnalyzer
 {
 public:
 	using FailureHandler = std::function<void(const char *state, size_t index, size_t time)>;
 
+	template< class Channel >
 	static inline bool
 	verify(const char *state_machine,
-	       const modm::GpioSampler::Channel &ch,
+	       const Channel &ch,
 	       FailureHandler failure = nullptr)
 	{
+		bool success = true;
 		const auto fn_fail = [&ch](const char *state, size_t index, int32_t time)
 		{
 			MODM_LOG_ERROR << "failed at '" << *state << "' with '" << ch[index] << "'";
@@ -38,6 +52,11 @@ public:
 			MODM_LOG_ERROR << modm::endl;
 		};
 		if (failure == nullptr) failure = fn_fail;
+		const auto fail = [&](const char *state, size_t index, int32_t time)
+		{
+			success = false;
+			failure(state, index, time);
+		};
 
 		const char *state = state_machine;
 		const char *repeat = nullptr;
@@ -57,23 +76,23 @@ public:
 				case 'h': // high sample
 				{
 					if (int32_t diff = ch.diff(sidx); diff) {
-						if (diff < tmin) failure(state, sidx, -tmin);
-						if (tmax < diff) failure(state, sidx, tmax);
+						if (diff < tmin) fail(state, sidx, -tmin);
+						if (tmax < diff) fail(state, sidx, tmax);
 					}
 
 					int32_t sample = ch[sidx];
 					if (*state == 'l') {
-						if ((sample & 1) == 1) failure(state, sidx, 0);
+						if ((sample & 1) == 1) fail(state, sidx, 0);
 						// MODM_LOG_DEBUG << "l " << sample << modm::endl;
 					} else {
-						if ((sample & 1) == 0) failure(state, sidx, 0);
+						if ((sample & 1) == 0) fail(state, sidx, 0);
 						// MODM_LOG_DEBUG << "h " << sample << modm::endl;
 					}
 					time = &tmin;
 					break;
 				}
 				case '>': // next sample
-					if (sidx >= ch.max()) failure(state, sidx, 0);
+					if (sidx + 1 >= ch.size()) fail(state, sidx, 0);
 					time = &tmax;
 					sidx++;
 					// MODM_LOG_DEBUG << '>' << modm::endl;
@@ -83,7 +102,7 @@ public:
 				{
 					char *out;
 					const uint64_t us = strtoul(state, &out, 10);
-					const uint32_t cycles = (SystemCoreClock * us) / 1000000;
+					const uint32_t cycles = (frequency<Channel>() * us) / 1000000;
 					*time = cycles;
 					state = out;
 					// MODM_LOG_DEBUG << (time == &tmin ? "min " : "max ") << us << "us => " << cycles << modm::endl;
@@ -120,8 +139,23 @@ public:
 			}
 			state++;
 		}
-		return true;
+		return success;
+	}
+
+private:
+	template< class Channel >
+	static inline uint64_t
+	frequency()
+	{
+		if constexpr (requires { Channel::Frequency; }) {
+			return Channel::Frequency;
+		}
+#if __has_include(<modm/driver/gpio_sampler.hpp>)
+		else {
+			return SystemCoreClock;
+		}
+#endif
 	}
 };
 
-} // namespace modm::platform
+} // namespace modm_test
@@ -11,37 +11,6 @@
 
 #include "spi_master.hpp"
 
-uint8_t
-modm_test::platform::SpiMaster::acquire(void *ctx, ConfigurationHandler handler)
-{
-	if (context == nullptr)
-	{
-		context = ctx;
-		count = 1;
-		// if handler is not nullptr and is different from previous configuration
-		if (handler and configuration != handler) {
-			configuration = handler;
-			configuration();
-		}
-		return 1;
-	}
-
-	if (ctx == context)
-		return ++count;
-
-	return 0;
-}
-
-uint8_t
-modm_test::platform::SpiMaster::release(void *ctx)
-{
-	if (ctx == context)
-	{
-		if (--count == 0)
-			context = nullptr;
-	}
-	return count;
-}
 // ----------------------------------------------------------------------------
 
 modm::ResumableResult<uint8_t>
@@ -61,7 +30,7 @@ modm_test::platform::SpiMaster::transfer(uint8_t data)
 }
 
 modm::ResumableResult<void>
-modm_test::platform::SpiMaster::transfer(uint8_t * tx, uint8_t * rx, std::size_t length)
+modm_test::platform::SpiMaster::transfer(const uint8_t * tx, uint8_t * rx, std::size_t length)
 {
 	for(std::size_t i = 0; i < length; ++i) {
 		//if(tx != nullptr)
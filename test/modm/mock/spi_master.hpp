@@ -13,6 +13,7 @@
 #define MODM_TEST_MOCK_SPI_MASTER_HPP
 
 #include <modm/architecture/interface/spi_master.hpp>
+#include <modm/architecture/interface/spi_lock.hpp>
 #include <modm/container/doubly_linked_list.hpp>
 
 namespace modm_test
@@ -28,13 +29,9 @@ namespace platform
  *
  * @ingroup modm_test_mock_spi_master
  */
-class SpiMaster : public modm::SpiMaster
+class SpiMaster : public modm::SpiMaster, public modm::SpiLock<SpiMaster>
 {
 private:
-	static inline uint8_t count{0};
-	static inline void* context{nullptr};
-	static inline ConfigurationHandler configuration{nullptr};
-
 	static inline DataMode dataMode{DataMode::Mode0};
 	static inline DataOrder dataOrder{DataOrder::MsbFirst};
 
@@ -66,13 +63,6 @@ public:
 	}
 
 
-	static uint8_t
-	acquire(void *ctx, ConfigurationHandler handler = nullptr);
-
-	static uint8_t
-	release(void *ctx);
-
-
 	static uint8_t
 	transferBlocking(uint8_t data)
 	{
@@ -80,7 +70,7 @@ public:
 	}
 
 	static void
-	transferBlocking(uint8_t *tx, uint8_t *rx, std::size_t length)
+	transferBlocking(const uint8_t *tx, uint8_t *rx, std::size_t length)
 	{
 		RF_CALL_BLOCKING(transfer(tx, rx, length));
 	}
@@ -90,7 +80,7 @@ public:
 	transfer(uint8_t data);
 
 	static modm::ResumableResult<void>
-	transfer(uint8_t *tx, uint8_t *rx, std::size_t length);
+	transfer(const uint8_t *tx, uint8_t *rx, std::size_t length);
 
 public:
 	static std::size_t getTxBufferLength() {
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "bitbang_shifter_test.hpp"
+
+#include <modm/platform/spi/bitbang_spi_shifter.hpp>
+#include <modm/platform/i2c/bitbang_i2c_shifter.hpp>
+#include <modm-test/mock/logic_analyzer.hpp>
+
+using modm_test::GpioRecorder;
+using modm_test::LogicAnalyzer;
+
+namespace
+{
+
+constexpr uint32_t Frequency = 1'000'000'000;
+
+using Sck = GpioRecorder::Gpio<0>;
+using Mosi = GpioRecorder::Gpio<1>;
+using Miso = GpioRecorder::Gpio<2>;
+using Spi = modm::platform::detail::BitBangSpiShifter<Sck, Mosi, Miso, GpioRecorder::delay_ns>;
+// 10kHz results in 50us between clock edges
+constexpr uint16_t SpiDelay = Spi::halfPeriod(Frequency, 10'000);
+
+using Scl = GpioRecorder::Gpio<3>;
+using Sda = GpioRecorder::Gpio<4>;
+using I2c = modm::platform::detail::BitBangI2cShifter<Scl, Sda, GpioRecorder::delay_ns>;
+using Error = I2c::Error;
+// 100kHz results in 5us between clock edges
+constexpr uint16_t I2cDelay = I2c::quarterPeriod(Frequency, 100'000);
+
+// Minimal I2C slave clocked by the recorded rising edges of SCL
+struct I2cSlave
+{
+	static inline bool ack{true};
+	static inline bool transmit{false};
+	static inline bool busy{false};
+	static inline uint8_t data{0};
+	static inline uint16_t stretch{0};
+
+	static std::size_t
+	clocks()
+	{
+		const auto &scl = Scl::channel();
+		std::size_t count{0};
+		for (std::size_t index = 1; index < scl.size(); ++index)
+			count += scl.read(index);
+		return count;
+	}
+
+	static bool
+	sda()
+	{
+		bool pull = busy;
+		if (Scl::isSet())
+		{
+			// data bits are 1-8, the acknowledge bit is 0
+			const std::size_t bit = clocks() % 9;
+			if (bit == 0) pull |= ack and not transmit;
+			else if (transmit) pull |= not (data & (0x80u >> (bit - 1)));
+		}
+		return Sda::isSet() and not pull;
+	}
+
+	static bool
+	scl()
+	{
+		if (stretch) { stretch--; return false; }
+		return Scl::isSet();
+	}
+};
+
+// Decodes the level of SDA at every rising edge of SCL
+uint32_t
+decodeI2c(std::size_t first, std::size_t count)
+{
+	const auto &scl = Scl::channel();
+	const auto &sda = Sda::channel();
+	uint32_t bits{0};
+	std::size_t clock{0};
+	for (std::size_t index = 1; index < scl.size(); ++index)
+	{
+		if (not scl.read(index)) continue;
+		if (clock++ < first) continue;
+		if (clock > first + count) break;
+		const uint32_t time = scl[index] & ~1u;
+		bool level = sda.read(0);
+		for (uint32_t sample : sda)
+			if ((sample & ~1u) <= time) level = sample & 1;
+		bits = (bits << 1) | level;
+	}
+	return bits;
+}
+
+}	// anonymous namespace
+
+void
+BitBangShifterTest::setUp()
+{
+	Miso::input = [] { return Mosi::isSet(); };
+	Sda::input = I2cSlave::sda;
+	Scl::input = I2cSlave::scl;
+	I2cSlave::ack = true;
+	I2cSlave::transmit = false;
+	I2cSlave::busy = false;
+	I2cSlave::stretch = 0;
+
+	Sck::reset();
+	Mosi::reset();
+	Scl::reset();
+	Sda::set();
+	GpioRecorder::restart<Sck, Mosi, Miso, Scl, Sda>();
+}
+
+void
+BitBangShifterTest::testSpiHalfPeriod()
+{
+	// 8 cycles of overhead at 1GHz
+	TEST_ASSERT_EQUALS(SpiDelay, 49'992u);
+	// 8 cycles at 16MHz are 500ns
+	TEST_ASSERT_EQUALS(Spi::halfPeriod(16'000'000, 500'000), 500u);
+	// too fast to delay at all
+	TEST_ASSERT_EQUALS(Spi::halfPeriod(16'000'000, 1'000'000), 0u);
+	TEST_ASSERT_EQUALS(Spi::halfPeriod(16'000'000, 8'000'000), 0u);
+	// limited to the delay type
+	TEST_ASSERT_EQUALS(Spi::halfPeriod(Frequency, 1'000), 0xffffu);
+}
+
+void
+BitBangShifterTest::testSpiMsbFirst()
+{
+	TEST_ASSERT_EQUALS(Spi::transfer<0b000>(0b0001'1110, SpiDelay), 0b0001'1110u);
+	TEST_ASSERT_EQUALS(GpioRecorder::now(), 16u * SpiDelay);
+
+	TEST_ASSERT_EQUALS(Sck::channel().size(), 17u);
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("l {8}( > h 45>55 l )", Sck::channel()));
+	// data changes half a clock before the rising edge
+	TEST_ASSERT_EQUALS(Mosi::channel().size(), 3u);
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("l 295>305 h 395>405 l", Mosi::channel()));
+
+	// timing violations are detected
+	TEST_ASSERT_FALSE(LogicAnalyzer::verify("l 305>400 h", Mosi::channel(), [](auto...) {}));
+	TEST_ASSERT_FALSE(LogicAnalyzer::verify("h", Mosi::channel(), [](auto...) {}));
+}
+
+void
+BitBangShifterTest::testSpiLsbFirst()
+{
+	TEST_ASSERT_EQUALS(Spi::transfer<0b100>(0b0001'1110, SpiDelay), 0b0001'1110u);
+
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("l {8}( > h 45>55 l )", Sck::channel()));
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("l 95>105 h 395>405 l", Mosi::channel()));
+
+	// the bit order is reversed
+	Miso::input = [] { return true; };
+	GpioRecorder::restart<Sck, Mosi>();
+	TEST_ASSERT_EQUALS(Spi::transfer<0b100>(0b1000'0000, SpiDelay), 0xffu);
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("l 695>705 h", Mosi::channel()));
+}
+
+void
+BitBangShifterTest::testSpiMode3()
+{
+	// clock idles high
+	Sck::set();
+	GpioRecorder::restart<Sck, Mosi>();
+
+	TEST_ASSERT_EQUALS(Spi::transfer<0b011>(0b0001'1110, SpiDelay), 0b0001'1110u);
+	TEST_ASSERT_EQUALS(GpioRecorder::now(), 16u * SpiDelay);
+
+	TEST_ASSERT_EQUALS(Sck::channel().size(), 17u);
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("h {8}( > l 45>55 h )", Sck::channel()));
+	// data changes on the falling edge
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("l 345>355 h 395>405 l", Mosi::channel()));
+}
+
+void
+BitBangShifterTest::testSpiModes()
+{
+	const auto check = []<uint8_t mode>(uint8_t data)
+	{
+		Sck::set(mode & 0b10);
+		GpioRecorder::restart<Sck, Mosi>();
+		const uint8_t rx = Spi::transfer<mode>(data, SpiDelay);
+		// the clock returns to its idle level
+		return (rx == data) and (Sck::isSet() == bool(mode & 0b10)) and
+			   (Sck::channel().size() == 17);
+	};
+	for (uint8_t data : {0x00, 0xff, 0xa5, 0x5a, 0x01, 0x80})
+	{
+		TEST_ASSERT_TRUE(check.operator()<0b000>(data));
+		TEST_ASSERT_TRUE(check.operator()<0b001>(data));
+		TEST_ASSERT_TRUE(check.operator()<0b010>(data));
+		TEST_ASSERT_TRUE(check.operator()<0b011>(data));
+		TEST_ASSERT_TRUE(check.operator()<0b100>(data));
+		TEST_ASSERT_TRUE(check.operator()<0b101>(data));
+		TEST_ASSERT_TRUE(check.operator()<0b110>(data));
+		TEST_ASSERT_TRUE(check.operator()<0b111>(data));
+	}
+
+	// inverted MISO
+	Miso::input = [] { return not Mosi::isSet(); };
+	TEST_ASSERT_EQUALS(Spi::transfer<0b000>(0x0f, SpiDelay), 0xf0u);
+	TEST_ASSERT_EQUALS(Spi::transfer<0b101>(0x33, SpiDelay), 0xccu);
+}
+
+void
+BitBangShifterTest::testSpiBuffer()
+{
+	const uint8_t tx[] = {0x12, 0x34, 0x56};
+	uint8_t rx[3]{};
+	Spi::transfer<0b000>(tx, rx, 3, SpiDelay);
+	TEST_ASSERT_EQUALS_ARRAY(rx, tx, 3);
+	TEST_ASSERT_EQUALS(GpioRecorder::now(), 3 * 16u * SpiDelay);
+	TEST_ASSERT_EQUALS(Sck::channel().size(), 3 * 16u + 1);
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("l {24}( > h 45>55 l )", Sck::channel()));
+
+	// without transmit buffer all bits are high
+	Spi::transfer<0b000>(nullptr, rx, 2, SpiDelay);
+	TEST_ASSERT_EQUALS(rx[0], 0xffu);
+	TEST_ASSERT_EQUALS(rx[1], 0xffu);
+	TEST_ASSERT_EQUALS(rx[2], 0x56u);
+
+	// without receive buffer
+	GpioRecorder::restart<Sck, Mosi>();
+	Spi::transfer<0b000>(tx, nullptr, 1, SpiDelay);
+	TEST_ASSERT_EQUALS(Sck::channel().size(), 17u);
+
+	// without delay
+	GpioRecorder::restart<Sck, Mosi>();
+	Spi::transfer<0b000>(tx, rx, 3, 0);
+	TEST_ASSERT_EQUALS(GpioRecorder::now(), 0u);
+	TEST_ASSERT_EQUALS_ARRAY(rx, tx, 3);
+}
+
+void
+BitBangShifterTest::testI2cQuarterPeriod()
+{
+	// 12 cycles of overhead at 1GHz
+	TEST_ASSERT_EQUALS(I2cDelay, 2'488u);
+	// 12 cycles at 48MHz are 250ns
+	TEST_ASSERT_EQUALS(I2c::quarterPeriod(48'000'000, 400'000), 375u);
+	TEST_ASSERT_EQUALS(I2c::quarterPeriod(8'000'000, 400'000), 0u);
+}
+
+void
+BitBangShifterTest::testI2cWrite()
+{
+	const uint8_t data[] = {0xa5, 0x3c};
+	TEST_ASSERT_TRUE(I2c::write(data[0], I2cDelay) == Error::NoError);
+	// 8 data bits and the acknowledge bit of 4 quarter periods each
+	TEST_ASSERT_EQUALS(GpioRecorder::now(), 36u * I2cDelay);
+	TEST_ASSERT_EQUALS(Scl::channel().size(), 19u);
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("l {9}( > h 4>6 l )", Scl::channel()));
+	// MSB first, released for acknowledge
+	TEST_ASSERT_EQUALS(decodeI2c(0, 9), 0b1'0100'1011u);
+
+	Scl::reset();
+	GpioRecorder::restart<Scl, Sda>();
+	TEST_ASSERT_TRUE(I2c::write(data, 2, I2cDelay) == Error::NoError);
+	TEST_ASSERT_EQUALS(Scl::channel().size(), 37u);
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("l {18}( > h 4>6 l )", Scl::channel()));
+	TEST_ASSERT_EQUALS(decodeI2c(0, 9), 0b1'0100'1011u);
+	TEST_ASSERT_EQUALS(decodeI2c(9, 9), 0b0'0111'1001u);
+}
+
+void
+BitBangShifterTest::testI2cRead()
+{
+	I2cSlave::transmit = true;
+	I2cSlave::data = 0x96;
+
+	uint8_t data[3]{};
+	TEST_ASSERT_TRUE(I2c::read(data, 3, I2cDelay) == Error::NoError);
+	TEST_ASSERT_EQUALS(data[0], 0x96u);
+	TEST_ASSERT_EQUALS(data[1], 0x96u);
+	TEST_ASSERT_EQUALS(data[2], 0x96u);
+	TEST_ASSERT_EQUALS(GpioRecorder::now(), 3 * 36u * I2cDelay);
+	TEST_ASSERT_TRUE(LogicAnalyzer::verify("l {27}( > h 4>6 l )", Scl::channel()));
+	// the master releases the data line and acknowledges all but the last byte
+	TEST_ASSERT_EQUALS(decodeI2c(0, 9), 0b1'1111'1110u);
+	TEST_ASSERT_EQUALS(decodeI2c(9, 9), 0b1'1111'1110u);
+	TEST_ASSERT_EQUALS(decodeI2c(18, 9), 0b1'1111'1111u);
+	TEST_ASSERT_TRUE(Sda::isSet());
+}
+
+void
+BitBangShifterTest::testI2cNack()
+{
+	I2cSlave::ack = false;
+	TEST_ASSERT_TRUE(I2c::write(0x42, I2cDelay) == Error::DataNack);
+
+	const uint8_t data[] = {0x01, 0x02};
+	TEST_ASSERT_TRUE(I2c::write(data, 2, I2cDelay) == Error::DataNack);
+}
+
+void
+BitBangShifterTest::testI2cArbitration()
+{
+	// another master pulls the data line low
+	I2cSlave::busy = true;
+	// which also acknowledges
+	TEST_ASSERT_TRUE(I2c::write(0x00, I2cDelay) == Error::NoError);
+	TEST_ASSERT_TRUE(I2c::write(0x80, I2cDelay) == Error::ArbitrationLost);
+
+	uint8_t data{0};
+	TEST_ASSERT_TRUE(I2c::read(data, true, I2cDelay) == Error::NoError);
+	TEST_ASSERT_EQUALS(data, 0x00u);
+	TEST_ASSERT_TRUE(I2c::read(data, false, I2cDelay) == Error::ArbitrationLost);
+}
+
+void
+BitBangShifterTest::testI2cClockStretching()
+{
+	// the slave holds the clock low for a little while
+	I2cSlave::stretch = 3;
+	TEST_ASSERT_TRUE(I2c::sclSetAndWait(I2cDelay));
+	TEST_ASSERT_EQUALS(GpioRecorder::now(), 3u * I2cDelay);
+
+	// and for too long
+	Scl::reset();
+	GpioRecorder::restart<Scl, Sda>();
+	I2cSlave::stretch = 1000;
+	TEST_ASSERT_FALSE(I2c::sclSetAndWait(I2cDelay));
+	TEST_ASSERT_EQUALS(GpioRecorder::now(), 250 * 2u * I2cDelay);
+
+	Scl::reset();
+	I2cSlave::stretch = 1000;
+	TEST_ASSERT_TRUE(I2c::write(0x00, I2cDelay) == Error::ArbitrationLost);
+}
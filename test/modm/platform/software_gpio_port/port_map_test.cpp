@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "port_map_test.hpp"
+
+#include <modm/platform/gpio/port_map.hpp>
+
+using modm::platform::detail::GpioPortMap;
+
+namespace
+{
+
+// Reference implementation moving one bit at a time
+template< typename Data, int8_t... Pins >
+constexpr Data
+gatherBitwise(uint32_t port)
+{
+	constexpr int8_t pins[]{Pins...};
+	constexpr std::size_t width = sizeof...(Pins);
+	Data data{0};
+	for (std::size_t index = 0; index < width; ++index)
+	{
+		if (pins[index] < 0) continue;
+		if (port & (1ul << pins[index]))
+			data |= Data(1ul << (width - 1 - index));
+	}
+	return data;
+}
+
+template< int8_t... Pins >
+constexpr uint32_t
+scatterBitwise(uint32_t data)
+{
+	constexpr int8_t pins[]{Pins...};
+	constexpr std::size_t width = sizeof...(Pins);
+	uint32_t port{0};
+	for (std::size_t index = 0; index < width; ++index)
+	{
+		if (pins[index] < 0) continue;
+		if (data & (1ul << (width - 1 - index)))
+			port |= 1ul << pins[index];
+	}
+	return port;
+}
+
+template< typename Data, int8_t... Pins >
+bool
+matchesBitwise(uint32_t data, uint32_t port)
+{
+	using Map = GpioPortMap<Pins...>;
+	return (Map::template gather<Data>(port) == gatherBitwise<Data, Pins...>(port)) and
+		   (Map::template scatter<uint32_t>(Data(data)) == scatterBitwise<Pins...>(data));
+}
+
+constexpr uint32_t patterns[] =
+{
+	0x00000000, 0xffffffff, 0xaaaaaaaa, 0x55555555,
+	0x12345678, 0x87654321, 0x0000ffff, 0xffff0000,
+	0xdeadbeef, 0x00000001, 0x80000000, 0x0f0f0f0f,
+};
+
+}	// anonymous namespace
+
+void
+GpioPortMapTest::testGroupCount()
+{
+	// consecutive pins form a single run
+	static_assert(GpioPortMap<7, 6, 5, 4>::count() == 1);
+	static_assert(GpioPortMap<11, 10, 9, 8>::count() == 1);
+	// pins with the same distance share a group even without being adjacent
+	static_assert(GpioPortMap<9, -1, 7, -1>::count() == 1);
+	// two runs
+	static_assert(GpioPortMap<15, 14, 3, 2>::count() == 2);
+	// reversed pins cannot be grouped
+	static_assert(GpioPortMap<0, 1, 2, 3>::count() == 4);
+	// no pins of this port
+	static_assert(GpioPortMap<-1, -1>::count() == 0);
+
+	TEST_ASSERT_EQUALS((GpioPortMap<7, 6, 5, 4>::count()), 1u);
+	TEST_ASSERT_EQUALS((GpioPortMap<15, 14, 3, 2>::count()), 2u);
+	TEST_ASSERT_EQUALS((GpioPortMap<0, 1, 2, 3>::count()), 4u);
+	TEST_ASSERT_EQUALS((GpioPortMap<-1, -1>::count()), 0u);
+}
+
+void
+GpioPortMapTest::testConsecutive()
+{
+	using Map = GpioPortMap<11, 10, 9, 8>;
+	TEST_ASSERT_EQUALS(Map::gather<uint8_t>(uint16_t(0x0a00)), 0x0au);
+	TEST_ASSERT_EQUALS(Map::gather<uint8_t>(uint16_t(0xf5ff)), 0x05u);
+	TEST_ASSERT_EQUALS(Map::scatter<uint16_t>(uint8_t(0x0a)), 0x0a00u);
+	// bits outside of the port width are ignored
+	TEST_ASSERT_EQUALS(Map::scatter<uint16_t>(uint8_t(0xf3)), 0x0300u);
+
+	for (uint32_t pattern : patterns)
+	{
+		TEST_ASSERT_TRUE((matchesBitwise<uint8_t, 11, 10, 9, 8>(pattern, pattern)));
+		TEST_ASSERT_TRUE((matchesBitwise<uint8_t, 3, 2, 1, 0>(pattern, pattern)));
+	}
+}
+
+void
+GpioPortMapTest::testScattered()
+{
+	// pins move both up (shift > 0) and down (shift < 0)
+	using Map = GpioPortMap<1, 0, 15, 14, 7, 6, 13, 4>;
+	static_assert(Map::count() == 4);
+	for (uint32_t pattern : patterns)
+	{
+		TEST_ASSERT_TRUE((matchesBitwise<uint8_t, 1, 0, 15, 14, 7, 6, 13, 4>(pattern, pattern)));
+		// round-trip
+		TEST_ASSERT_EQUALS(Map::gather<uint8_t>(Map::scatter<uint16_t>(uint8_t(pattern))),
+						   uint8_t(pattern));
+	}
+}
+
+void
+GpioPortMapTest::testReversed()
+{
+	using Map = GpioPortMap<0, 1, 2, 3, 4, 5, 6, 7>;
+	TEST_ASSERT_EQUALS(Map::gather<uint8_t>(uint8_t(0x01)), 0x80u);
+	TEST_ASSERT_EQUALS(Map::gather<uint8_t>(uint8_t(0x0f)), 0xf0u);
+	TEST_ASSERT_EQUALS(Map::scatter<uint8_t>(uint8_t(0x80)), 0x01u);
+	TEST_ASSERT_EQUALS(Map::scatter<uint8_t>(uint8_t(0xc3)), 0xc3u);
+	for (uint32_t pattern : patterns)
+	{
+		TEST_ASSERT_TRUE((matchesBitwise<uint8_t, 0, 1, 2, 3, 4, 5, 6, 7>(pattern, pattern)));
+	}
+}
+
+void
+GpioPortMapTest::testUnconnected()
+{
+	// bits of other ports are neither read nor written
+	using Map = GpioPortMap<5, -1, -1, 4, -1, 0>;
+	TEST_ASSERT_EQUALS(Map::gather<uint8_t>(uint32_t(0xffffffff)), 0b100101u);
+	TEST_ASSERT_EQUALS(Map::scatter<uint32_t>(uint8_t(0xff)), 0b110001u);
+	TEST_ASSERT_EQUALS(Map::scatter<uint32_t>(uint8_t(0b011010)), 0u);
+	for (uint32_t pattern : patterns)
+	{
+		TEST_ASSERT_TRUE((matchesBitwise<uint8_t, 5, -1, -1, 4, -1, 0>(pattern, pattern)));
+	}
+
+	using Empty = GpioPortMap<-1, -1, -1>;
+	TEST_ASSERT_EQUALS(Empty::gather<uint8_t>(uint32_t(0xffffffff)), 0u);
+	TEST_ASSERT_EQUALS(Empty::scatter<uint32_t>(uint8_t(0xff)), 0u);
+}
+
+void
+GpioPortMapTest::testWidth32()
+{
+	using Identity = GpioPortMap<31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+								 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0>;
+	static_assert(Identity::count() == 1);
+	static_assert(Identity::gather<uint32_t>(uint32_t(0xdeadbeef)) == 0xdeadbeef);
+
+	// swap the two halfwords
+	using Swap = GpioPortMap<15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+							 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16>;
+	static_assert(Swap::count() == 2);
+	for (uint32_t pattern : patterns)
+	{
+		TEST_ASSERT_EQUALS(Identity::gather<uint32_t>(pattern), pattern);
+		TEST_ASSERT_EQUALS(Identity::scatter<uint32_t>(pattern), pattern);
+		TEST_ASSERT_EQUALS(Swap::gather<uint32_t>(pattern), (pattern << 16) | (pattern >> 16));
+		TEST_ASSERT_EQUALS(Swap::scatter<uint32_t>(pattern), (pattern << 16) | (pattern >> 16));
+	}
+}
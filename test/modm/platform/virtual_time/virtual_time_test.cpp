@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/platform/core/virtual_time.hpp>
+#include <modm/processing/fiber.hpp>
+#include <modm/processing/timer.hpp>
+
+#include "virtual_time_test.hpp"
+
+using namespace std::chrono_literals;
+using modm::platform::VirtualTime;
+
+namespace
+{
+
+// The unittests replace the system clocks with a mock, so the timeouts here
+// use a clock that reads the virtual time directly.
+struct VirtualClock
+{
+	using duration = std::chrono::milliseconds;
+	using rep = duration::rep;
+	using period = duration::period;
+	using time_point = std::chrono::time_point<VirtualClock, duration>;
+	static constexpr bool is_steady = true;
+
+	static time_point
+	now()
+	{ return time_point{std::chrono::duration_cast<duration>(VirtualTime::now())}; }
+};
+
+using Timeout = modm::GenericTimeout<VirtualClock, VirtualClock::duration>;
+
+void
+sleep(VirtualClock::duration interval)
+{
+	Timeout timeout(interval);
+	while (not timeout.isExpired()) modm::fiber::yield();
+}
+
+VirtualTime::duration start;
+
+struct Wakeup
+{
+	char fiber;
+	VirtualTime::duration time;
+};
+Wakeup wakeups[8];
+size_t wakeups_pos{0};
+
+void
+wakeup(char fiber)
+{
+	if (wakeups_pos < 8) wakeups[wakeups_pos++] = {fiber, VirtualTime::now() - start};
+}
+
+modm::fiber::Stack<4096> stack1, stack2;
+
+}
+
+void
+VirtualTimeTest::setUp()
+{
+	// drop pending wakeups registered by other tests
+	while (VirtualTime::advanceToWakeup()) ;
+	VirtualTime::takeIdle();
+	// align the start to the millisecond ticks of the clock
+	if (const auto offset = VirtualTime::now() % 1ms; offset.count())
+		VirtualTime::advance(1ms - offset);
+	start = VirtualTime::now();
+	wakeups_pos = 0;
+}
+
+void
+VirtualTimeTest::testAdvance()
+{
+	TEST_ASSERT_TRUE(VirtualTime::getNextWakeup() == VirtualTime::duration::max());
+	TEST_ASSERT_FALSE(VirtualTime::advanceToWakeup());
+	TEST_ASSERT_TRUE(VirtualTime::now() == start);
+
+	VirtualTime::advance(1500us);
+	TEST_ASSERT_TRUE(VirtualTime::now() - start == 1500us);
+	VirtualTime::advance(2s);
+	TEST_ASSERT_TRUE(VirtualTime::now() - start == 2001500us);
+}
+
+void
+VirtualTimeTest::testAdvanceToWakeup()
+{
+	Timeout slow(20ms), fast(5ms);
+	TEST_ASSERT_FALSE(slow.isExpired());
+	TEST_ASSERT_FALSE(fast.isExpired());
+	TEST_ASSERT_TRUE(VirtualTime::getNextWakeup() - start == 5ms);
+
+	// jumps to the earliest wakeup only
+	TEST_ASSERT_TRUE(VirtualTime::advanceToWakeup());
+	TEST_ASSERT_TRUE(VirtualTime::now() - start == 5ms);
+	TEST_ASSERT_TRUE(fast.isExpired());
+	TEST_ASSERT_FALSE(slow.isExpired());
+
+	TEST_ASSERT_TRUE(VirtualTime::advanceToWakeup());
+	TEST_ASSERT_TRUE(VirtualTime::now() - start == 20ms);
+	TEST_ASSERT_TRUE(slow.isExpired());
+	TEST_ASSERT_FALSE(VirtualTime::advanceToWakeup());
+}
+
+void
+VirtualTimeTest::testSleepingFibers()
+{
+	modm::fiber::Task fiber1(stack1, []()
+	{
+		sleep(25ms);
+		wakeup('a');
+	});
+	modm::fiber::Task fiber2(stack2, []()
+	{
+		for (int ii = 0; ii < 3; ++ii)
+		{
+			sleep(10ms);
+			wakeup('b');
+		}
+	});
+	modm::fiber::Scheduler::run();
+
+	TEST_ASSERT_EQUALS(wakeups_pos, 4u);
+	TEST_ASSERT_EQUALS(wakeups[0].fiber, 'b');
+	TEST_ASSERT_TRUE(wakeups[0].time == 10ms);
+	TEST_ASSERT_EQUALS(wakeups[1].fiber, 'b');
+	TEST_ASSERT_TRUE(wakeups[1].time == 20ms);
+	TEST_ASSERT_EQUALS(wakeups[2].fiber, 'a');
+	TEST_ASSERT_TRUE(wakeups[2].time == 25ms);
+	TEST_ASSERT_EQUALS(wakeups[3].fiber, 'b');
+	TEST_ASSERT_TRUE(wakeups[3].time == 30ms);
+	TEST_ASSERT_TRUE(VirtualTime::now() - start == 30ms);
+}
+
+void
+VirtualTimeTest::testBusyFiber()
+{
+	modm::fiber::Task fiber1(stack1, []()
+	{
+		sleep(10ms);
+		wakeup('a');
+	});
+	modm::fiber::Task fiber2(stack2, []()
+	{
+		// the time must not advance while a fiber is busy
+		for (int ii = 0; ii < 100; ++ii) modm::fiber::yield();
+		wakeup('b');
+	});
+	modm::fiber::Scheduler::run();
+
+	TEST_ASSERT_EQUALS(wakeups_pos, 2u);
+	TEST_ASSERT_EQUALS(wakeups[0].fiber, 'b');
+	TEST_ASSERT_TRUE(wakeups[0].time == 0ms);
+	TEST_ASSERT_EQUALS(wakeups[1].fiber, 'a');
+	TEST_ASSERT_TRUE(wakeups[1].time == 10ms);
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "coroutine_test.hpp"
+
+#include <modm/processing/coroutine.hpp>
+#include <modm-test/mock/clock.hpp>
+
+using namespace std::chrono_literals;
+using test_clock = modm_test::chrono::milli_clock;
+
+namespace
+{
+
+uint8_t counter;
+
+modm::coro::Task<>
+counting(uint8_t yields)
+{
+	for (uint8_t ii = 0; ii < yields; ++ii)
+	{
+		counter++;
+		co_await modm::coro::yield();
+	}
+	counter++;
+}
+
+modm::coro::Task<int>
+add(int a, int b)
+{
+	co_await modm::coro::yield();
+	co_return a + b;
+}
+
+modm::coro::Task<int>
+sum(int count)
+{
+	int total{0};
+	for (int ii = 1; ii <= count; ++ii)
+	{
+		// the local variables survive the suspension of the nested task
+		total = co_await add(total, ii);
+	}
+	co_return total;
+}
+
+class Sensor : public modm::NestedResumable<2>
+{
+public:
+	bool ready{false};
+
+	modm::ResumableResult<uint8_t>
+	read()
+	{
+		RF_BEGIN();
+		RF_WAIT_UNTIL(ready);
+		RF_CALL(wait());
+		RF_END_RETURN(42);
+	}
+
+	modm::ResumableResult<void>
+	wait()
+	{
+		RF_BEGIN();
+		RF_YIELD();
+		RF_END();
+	}
+};
+
+}
+
+void
+CoroutineTest::testYield()
+{
+	counter = 0;
+	auto task = counting(3);
+	// tasks are started lazily
+	TEST_ASSERT_EQUALS(counter, 0u);
+	TEST_ASSERT_TRUE(task.isRunning());
+
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_EQUALS(counter, 1u);
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_EQUALS(counter, 2u);
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_EQUALS(counter, 3u);
+	TEST_ASSERT_FALSE(task.run());
+	TEST_ASSERT_EQUALS(counter, 4u);
+	TEST_ASSERT_FALSE(task.isRunning());
+
+	// a finished task does not run again
+	TEST_ASSERT_FALSE(task.run());
+	TEST_ASSERT_EQUALS(counter, 4u);
+}
+
+void
+CoroutineTest::testNested()
+{
+	auto task = sum(4);
+	uint8_t runs{1};
+	while (task.run()) runs++;
+	// every nested call yields once, then the outer task returns
+	TEST_ASSERT_EQUALS(runs, 5u);
+	TEST_ASSERT_EQUALS(task.getResult(), 1 + 2 + 3 + 4);
+}
+
+void
+CoroutineTest::testSleep()
+{
+	test_clock::setTime(1000);
+	counter = 0;
+	auto task = []() -> modm::coro::Task<>
+	{
+		co_await modm::coro::sleep(10ms);
+		counter++;
+		co_await modm::coro::sleep(5ms);
+		counter++;
+	}();
+
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_EQUALS(counter, 0u);
+	test_clock::increment(9);
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_EQUALS(counter, 0u);
+	test_clock::increment(1);
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_EQUALS(counter, 1u);
+	test_clock::increment(4);
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_EQUALS(counter, 1u);
+	test_clock::increment(1);
+	TEST_ASSERT_FALSE(task.run());
+	TEST_ASSERT_EQUALS(counter, 2u);
+}
+
+void
+CoroutineTest::testUntil()
+{
+	test_clock::setTime(1000);
+	static bool flag;
+	static bool results[2];
+	flag = false;
+	auto task = []() -> modm::coro::Task<>
+	{
+		co_await modm::coro::until([]{ return flag; });
+		results[0] = co_await modm::coro::until([]{ return flag; }, 10ms);
+		flag = false;
+		results[1] = co_await modm::coro::until([]{ return flag; }, 10ms);
+	}();
+
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_TRUE(task.run());
+	flag = true;
+	// the condition is already fulfilled when awaited
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_TRUE(results[0]);
+	test_clock::increment(9);
+	TEST_ASSERT_TRUE(task.run());
+	test_clock::increment(1);
+	TEST_ASSERT_FALSE(task.run());
+	TEST_ASSERT_FALSE(results[1]);
+}
+
+void
+CoroutineTest::testResumable()
+{
+	static Sensor sensor;
+	static uint8_t value;
+	sensor.ready = false;
+	value = 0;
+	auto task = []() -> modm::coro::Task<>
+	{
+		value = co_await modm::coro::call([]{ return sensor.read(); });
+	}();
+
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_TRUE(task.run());
+	sensor.ready = true;
+	// RF_CALL(wait()) yields once
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_FALSE(task.run());
+	TEST_ASSERT_EQUALS(value, 42u);
+}
+
+void
+CoroutineTest::testFramePool()
+{
+	const size_t used = modm::coro::framePool.size();
+	{
+		auto task = sum(2);
+		TEST_ASSERT_EQUALS(modm::coro::framePool.size(), used + 1);
+		task.run();
+		// the nested task allocates a second frame
+		TEST_ASSERT_EQUALS(modm::coro::framePool.size(), used + 2);
+		while (task.run()) ;
+		TEST_ASSERT_EQUALS(modm::coro::framePool.size(), used + 1);
+
+		auto moved = std::move(task);
+		TEST_ASSERT_FALSE(task.isRunning());
+		TEST_ASSERT_EQUALS(moved.getResult(), 3);
+	}
+	TEST_ASSERT_EQUALS(modm::coro::framePool.size(), used);
+	TEST_ASSERT_TRUE(modm::coro::framePool.maxSize() >= 2u);
+	TEST_ASSERT_TRUE(modm::coro::framePool.maxFrameSize() > 0u);
+	TEST_ASSERT_TRUE(modm::coro::framePool.maxFrameSize() <= modm::coro::framePool.FrameSize);
+}
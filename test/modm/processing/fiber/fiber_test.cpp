@@ -12,6 +12,7 @@
 #include "fiber_test.hpp"
 
 #include <array>
+#include <chrono>
 #include <modm/debug/logger.hpp>
 #include <modm/processing/fiber.hpp>
 
@@ -114,3 +115,104 @@ FiberTest::testYieldFromSubroutine()
 	TEST_ASSERT_EQUALS(states[4], SUBROUTINE_END);
 	TEST_ASSERT_EQUALS(states[5], F3_END);
 }
+
+void
+FiberTest::testProfiling()
+{
+#if MODM_FIBER_PROFILING
+	using modm::fiber::Profile;
+	static constexpr auto busy = std::chrono::milliseconds(2);
+
+	modm::fiber::Task fiber1(stack1, []()
+	{
+		for (int ii = 0; ii < 3; ++ii)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			while (std::chrono::steady_clock::now() - start < busy) ;
+			modm::fiber::yield();
+		}
+	});
+	modm::fiber::Task fiber2(stack2, []()
+	{
+		for (int ii = 0; ii < 3; ++ii) modm::fiber::yield();
+	});
+	modm::fiber::Scheduler::run();
+
+	const Profile profile1 = fiber1.profile();
+	const Profile profile2 = fiber2.profile();
+	// started once and resumed after every yield
+	TEST_ASSERT_EQUALS(profile1.switches, 4u);
+	TEST_ASSERT_EQUALS(profile2.switches, 4u);
+	// fiber1 is busy, while fiber2 waits for it
+	TEST_ASSERT_TRUE(Profile::microseconds(profile1.runtime) >= 3 * 2'000u);
+	TEST_ASSERT_TRUE(profile2.runtime < profile1.runtime);
+	TEST_ASSERT_TRUE(Profile::microseconds(profile2.maxLatency) >= 2'000u);
+	TEST_ASSERT_TRUE(profile1.maxLatency < profile2.maxLatency);
+
+	fiber1.reset_profile();
+	TEST_ASSERT_EQUALS(fiber1.profile().runtime, 0u);
+	TEST_ASSERT_EQUALS(fiber1.profile().switches, 0u);
+	TEST_ASSERT_EQUALS(fiber1.profile().maxLatency, 0u);
+
+	// long runtimes must not overflow during conversion
+	const uint64_t hour = uint64_t(3600) * Profile::frequency();
+	TEST_ASSERT_EQUALS(Profile::microseconds(hour * 24 * 365), uint64_t(3600) * 24 * 365 * 1'000'000);
+	TEST_ASSERT_EQUALS(Profile::microseconds(hour + Profile::frequency() / 2), uint64_t(3600'500'000));
+#endif
+}
+
+namespace
+{
+modm::fiber::StackPool<4096, 2> pool;
+size_t pool_runs = 0;
+}
+
+void
+FiberTest::testStackPool()
+{
+	TEST_ASSERT_EQUALS(pool.available(), 2u);
+
+	const auto function = []()
+	{
+		volatile uint8_t buffer[512];
+		for (auto& b : buffer) b = pool_runs;
+		modm::fiber::yield();
+		pool_runs++;
+	};
+	modm::fiber::PooledTask task1(pool, function);
+	modm::fiber::PooledTask task2(pool, function);
+	modm::fiber::PooledTask task3(pool, function, modm::fiber::Start::Later);
+
+	// the pool is exhausted
+	TEST_ASSERT_TRUE(task1.hasStack());
+	TEST_ASSERT_TRUE(task2.hasStack());
+	TEST_ASSERT_EQUALS(pool.available(), 0u);
+	TEST_ASSERT_FALSE(task3.start());
+	TEST_ASSERT_FALSE(task3.isRunning());
+
+	pool_runs = 0;
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_EQUALS(pool_runs, 2u);
+	TEST_ASSERT_FALSE(task1.hasStack());
+	TEST_ASSERT_EQUALS(pool.available(), 2u);
+
+	// the stacks are reused by other tasks
+	TEST_ASSERT_TRUE(task3.start());
+	TEST_ASSERT_TRUE(task1.start());
+	TEST_ASSERT_EQUALS(pool.available(), 0u);
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_EQUALS(pool_runs, 4u);
+	TEST_ASSERT_EQUALS(pool.available(), 2u);
+
+	// peak memory of two stacks instead of three
+	TEST_ASSERT_EQUALS(pool.maxSize(), 2u);
+	TEST_ASSERT_EQUALS(pool.maxMemory(), 2u * 4096u);
+
+#if MODM_FIBER_PROFILING
+	TEST_ASSERT_TRUE(task1.max_stack_usage() >= 512u);
+	TEST_ASSERT_TRUE(task1.max_stack_usage() < 4096u);
+	TEST_ASSERT_TRUE(task1.recommended_stack_size() > task1.max_stack_usage());
+	TEST_ASSERT_EQUALS(task1.recommended_stack_size() % modm::fiber::StackAlignment, 0u);
+	TEST_ASSERT_EQUALS(task2.recommended_stack_size(), task1.recommended_stack_size());
+#endif
+}
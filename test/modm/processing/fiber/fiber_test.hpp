@@ -29,4 +29,10 @@ public:
 
 	void
 	testYieldFromSubroutine();
+
+	void
+	testProfiling();
+
+	void
+	testStackPool();
 };
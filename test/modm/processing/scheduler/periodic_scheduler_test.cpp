@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/processing/scheduler/periodic_scheduler.hpp>
+#include <modm-test/mock/clock.hpp>
+
+#include "periodic_scheduler_test.hpp"
+
+using namespace std::chrono_literals;
+using test_clock = modm_test::chrono::micro_clock;
+using Scheduler = modm::PeriodicScheduler<64, modm::chrono::micro_clock>;
+
+namespace
+{
+
+uint8_t count;
+
+class TestTask : public modm::Scheduler::Task
+{
+public:
+	void
+	run() override
+	{
+		order = ++count;
+		test_clock::increment(executionTime);
+		if (remove) scheduler->removeTask(*remove);
+	}
+
+	uint8_t order{0};
+	std::chrono::microseconds executionTime{0};
+	Scheduler* scheduler{nullptr};
+	modm::Scheduler::Task* remove{nullptr};
+};
+
+}
+
+// ----------------------------------------------------------------------------
+void
+PeriodicSchedulerTest::testPriorityOrder()
+{
+	test_clock::setTime(1000);
+	count = 0;
+	Scheduler scheduler;
+	TestTask task1, task2, task3;
+
+	TEST_ASSERT_TRUE(scheduler.addTask(task1, 30ms));
+	TEST_ASSERT_TRUE(scheduler.addTask(task2, 10ms));
+	TEST_ASSERT_TRUE(scheduler.addTask(task3, 20ms));
+	TEST_ASSERT_FALSE(scheduler.addTask(task3, 20ms));
+	TEST_ASSERT_FALSE(scheduler.addTask(task3, 0ms));
+	TEST_ASSERT_EQUALS(scheduler.getSize(), 3u);
+
+	// all tasks are released at once and run in rate-monotonic order
+	scheduler.run();
+	TEST_ASSERT_EQUALS(task1.order, 3);
+	TEST_ASSERT_EQUALS(task2.order, 1);
+	TEST_ASSERT_EQUALS(task3.order, 2);
+
+	// nothing is due
+	scheduler.run();
+	TEST_ASSERT_EQUALS(count, 3);
+
+	test_clock::increment(20ms);
+	scheduler.run();
+	TEST_ASSERT_EQUALS(task2.order, 4);
+	TEST_ASSERT_EQUALS(task3.order, 5);
+	TEST_ASSERT_EQUALS(task1.order, 3);
+}
+
+void
+PeriodicSchedulerTest::testRemoveTask()
+{
+	test_clock::setTime(1000);
+	count = 0;
+	Scheduler scheduler;
+	TestTask task1, task2, task3;
+
+	scheduler.addTask(task1, 10ms);
+	scheduler.addTask(task2, 20ms);
+	scheduler.addTask(task3, 30ms);
+	TEST_ASSERT_TRUE(scheduler.removeTask(task2));
+	TEST_ASSERT_FALSE(scheduler.removeTask(task2));
+	TEST_ASSERT_FALSE(scheduler.containsTask(task2));
+	TEST_ASSERT_TRUE(scheduler.getStatistics(task2) == nullptr);
+
+	// a running task removes itself and a task that is ready
+	task1.scheduler = &scheduler;
+	task1.remove = &task3;
+	scheduler.run();
+	TEST_ASSERT_EQUALS(task1.order, 1);
+	TEST_ASSERT_EQUALS(task3.order, 0);
+	TEST_ASSERT_EQUALS(scheduler.getSize(), 1u);
+
+	task1.remove = &task1;
+	test_clock::increment(10ms);
+	scheduler.run();
+	TEST_ASSERT_EQUALS(task1.order, 2);
+	TEST_ASSERT_EQUALS(scheduler.getSize(), 0u);
+	TEST_ASSERT_TRUE(scheduler.run() == Scheduler::duration::max());
+
+	// the slots can be reused
+	TEST_ASSERT_TRUE(scheduler.addTask(task2, 20ms));
+	TEST_ASSERT_EQUALS(scheduler.getSize(), 1u);
+}
+
+void
+PeriodicSchedulerTest::testTickless()
+{
+	test_clock::setTime(0xffff'fff0); // overflows during the test
+	count = 0;
+	Scheduler scheduler;
+	TestTask task1, task2;
+
+	scheduler.addTask(task1, 10ms, 0ms, 2ms);
+	scheduler.addTask(task2, 3ms);
+	TEST_ASSERT_TRUE(scheduler.run() == 2ms);
+	TEST_ASSERT_EQUALS(task2.order, 1);
+
+	test_clock::increment(1ms);
+	TEST_ASSERT_TRUE(scheduler.getTimeUntilNextRelease() == 1ms);
+	TEST_ASSERT_TRUE(scheduler.run() == 1ms);
+
+	test_clock::increment(1ms);
+	TEST_ASSERT_TRUE(scheduler.getTimeUntilNextRelease() == 0ms);
+	TEST_ASSERT_TRUE(scheduler.run() == 1ms);
+	TEST_ASSERT_EQUALS(task1.order, 2);
+
+	test_clock::increment(1ms);
+	TEST_ASSERT_TRUE(scheduler.run() == 3ms);
+	TEST_ASSERT_EQUALS(task2.order, 3);
+}
+
+void
+PeriodicSchedulerTest::testDeadlineMiss()
+{
+	test_clock::setTime(1000);
+	count = 0;
+	Scheduler scheduler;
+	TestTask task1, task2;
+
+	task1.executionTime = 3ms;
+	scheduler.addTask(task1, 10ms, 2ms);
+	scheduler.addTask(task2, 20ms);
+	scheduler.run();
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(task1)->misses, 1u);
+	TEST_ASSERT_TRUE(scheduler.getStatistics(task1)->maxResponse == 3ms);
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(task2)->misses, 0u);
+	TEST_ASSERT_TRUE(scheduler.getStatistics(task2)->maxJitter == 3ms);
+	TEST_ASSERT_TRUE(scheduler.getStatistics(task2)->maxResponse == 3ms);
+
+	// the task is late by more than two periods and runs only once
+	task1.executionTime = 0ms;
+	test_clock::increment(25ms);
+	scheduler.run();
+	const auto* statistics = scheduler.getStatistics(task1);
+	TEST_ASSERT_EQUALS(statistics->releases, 2u);
+	TEST_ASSERT_EQUALS(statistics->skips, 1u);
+	TEST_ASSERT_EQUALS(statistics->misses, 2u);
+	TEST_ASSERT_TRUE(statistics->maxJitter == 18ms);
+	// the phase is kept
+	TEST_ASSERT_TRUE(scheduler.getTimeUntilNextRelease() == 2ms);
+
+	scheduler.resetStatistics();
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(task1)->releases, 0u);
+}
+
+void
+PeriodicSchedulerTest::testJitter()
+{
+	// 50 tasks at 1 kHz with 10µs execution time each for one second
+	static constexpr size_t Tasks = 50;
+	static constexpr auto ExecutionTime = 10us;
+	test_clock::setTime(1000);
+	Scheduler scheduler;
+	TestTask tasks[Tasks];
+
+	for (auto& task : tasks)
+	{
+		task.executionTime = ExecutionTime;
+		TEST_ASSERT_TRUE(scheduler.addTask(task, 1ms));
+	}
+	for (size_t ii = 0; ii < 1000; ++ii)
+	{
+		const auto idle = scheduler.run();
+		TEST_ASSERT_TRUE(idle == 1ms - Tasks * ExecutionTime);
+		test_clock::increment(idle);
+	}
+
+	for (size_t ii = 0; ii < Tasks; ++ii)
+	{
+		const auto* statistics = scheduler.getStatistics(tasks[ii]);
+		TEST_ASSERT_EQUALS(statistics->releases, 1000u);
+		TEST_ASSERT_EQUALS(statistics->misses, 0u);
+		TEST_ASSERT_EQUALS(statistics->skips, 0u);
+		// a task only waits for the tasks with higher priority
+		TEST_ASSERT_TRUE(statistics->maxJitter == ii * ExecutionTime);
+		TEST_ASSERT_TRUE(statistics->maxResponse == (ii + 1) * ExecutionTime);
+	}
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "timer_queue_test.hpp"
+#include <modm/processing/timer.hpp>
+#include <modm-test/mock/clock.hpp>
+
+using namespace std::chrono_literals;
+using test_clock = modm_test::chrono::milli_clock;
+using Queue = modm::TimerQueue<>;
+
+namespace
+{
+uint8_t count;
+uint8_t order[4];
+}
+
+void
+TimerQueueTest::setUp()
+{
+	test_clock::setTime(1000);
+	count = 0;
+	for (auto& o : order) o = 0;
+}
+
+void
+TimerQueueTest::testOneShot()
+{
+	Queue queue;
+	Queue::Timer timer1([]{ order[0] = ++count; });
+	Queue::Timer timer2([]{ order[1] = ++count; });
+	Queue::Timer timer3;
+
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_TRUE(queue.getTimeUntilNextDeadline() == Queue::duration::max());
+
+	queue.start(timer1, 20ms);
+	queue.start(timer2, 10ms);
+	queue.start(timer3, 20ms);
+	TEST_ASSERT_TRUE(timer1.isArmed());
+	TEST_ASSERT_FALSE(timer1.isExpired());
+	TEST_ASSERT_TRUE(queue.getTimeUntilNextDeadline() == 10ms);
+
+	test_clock::increment(9);
+	TEST_ASSERT_EQUALS(queue.update(), 0u);
+	test_clock::increment(1);
+	TEST_ASSERT_EQUALS(queue.update(), 1u);
+	TEST_ASSERT_EQUALS(order[1], 1);
+	TEST_ASSERT_TRUE(timer2.isExpired());
+	TEST_ASSERT_FALSE(timer2.isArmed());
+	TEST_ASSERT_TRUE(queue.getTimeUntilNextDeadline() == 10ms);
+
+	// a timer without callback only sets the expired flag
+	test_clock::increment(15);
+	TEST_ASSERT_EQUALS(queue.update(), 2u);
+	TEST_ASSERT_EQUALS(order[0], 2);
+	TEST_ASSERT_TRUE(timer3.isExpired());
+	TEST_ASSERT_TRUE(queue.isEmpty());
+
+	// restarting clears the expired flag
+	queue.start(timer3, 5ms);
+	TEST_ASSERT_FALSE(timer3.isExpired());
+	TEST_ASSERT_TRUE(timer3.isArmed());
+}
+
+void
+TimerQueueTest::testPeriodic()
+{
+	Queue queue;
+	Queue::Timer timer([]{ ++count; });
+
+	queue.startPeriodic(timer, 10ms);
+	for (uint8_t ii = 1; ii <= 3; ++ii)
+	{
+		test_clock::increment(10);
+		TEST_ASSERT_EQUALS(queue.update(), 1u);
+		TEST_ASSERT_EQUALS(count, ii);
+		TEST_ASSERT_TRUE(timer.isArmed());
+	}
+	// missed periods are skipped, but the phase is kept
+	test_clock::increment(35);
+	TEST_ASSERT_EQUALS(queue.update(), 1u);
+	TEST_ASSERT_EQUALS(count, 4);
+	TEST_ASSERT_TRUE(queue.getTimeUntilNextDeadline() == 5ms);
+}
+
+void
+TimerQueueTest::testCancel()
+{
+	Queue queue;
+	Queue::Timer timer1([]{ order[0] = ++count; });
+	Queue::Timer timer2([]{ order[1] = ++count; });
+
+	queue.start(timer1, 10ms);
+	queue.start(timer2, 20ms);
+	TEST_ASSERT_TRUE(queue.cancel(timer1));
+	TEST_ASSERT_FALSE(queue.cancel(timer1));
+	TEST_ASSERT_FALSE(timer1.isArmed());
+	TEST_ASSERT_TRUE(queue.getTimeUntilNextDeadline() == 20ms);
+	{
+		// destroying an armed timer removes it from the queue
+		Queue::Timer timer3([]{ order[2] = ++count; });
+		queue.start(timer3, 5ms);
+		TEST_ASSERT_TRUE(queue.getTimeUntilNextDeadline() == 5ms);
+	}
+	TEST_ASSERT_TRUE(queue.getTimeUntilNextDeadline() == 20ms);
+
+	// a callback may cancel other timers
+	static Queue::Timer* other;
+	other = &timer2;
+	timer1.setCallback([&queue]{ order[0] = ++count; queue.cancel(*other); });
+	queue.start(timer1, 10ms);
+	test_clock::increment(30);
+	TEST_ASSERT_EQUALS(queue.update(), 1u);
+	TEST_ASSERT_EQUALS(order[0], 1);
+	TEST_ASSERT_EQUALS(order[1], 0);
+	TEST_ASSERT_EQUALS(order[2], 0);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void
+TimerQueueTest::testRunning()
+{
+	static Queue queue;
+	static Queue::Timer timer;
+	// the timer is marked as running only during its callback
+	timer.setCallback([]
+	{
+		order[0] = timer.isRunning();
+		// cancelling itself prevents the next period
+		if (++count == 2) queue.cancel(timer);
+	});
+
+	queue.startPeriodic(timer, 10ms);
+	TEST_ASSERT_FALSE(timer.isRunning());
+	test_clock::increment(10);
+	TEST_ASSERT_EQUALS(queue.update(), 1u);
+	TEST_ASSERT_EQUALS(order[0], 1);
+	TEST_ASSERT_FALSE(timer.isRunning());
+	TEST_ASSERT_TRUE(timer.isArmed());
+
+	test_clock::increment(10);
+	TEST_ASSERT_EQUALS(queue.update(), 1u);
+	TEST_ASSERT_EQUALS(count, 2);
+	TEST_ASSERT_FALSE(timer.isArmed());
+	TEST_ASSERT_TRUE(queue.isEmpty());
+
+	test_clock::increment(10);
+	TEST_ASSERT_EQUALS(queue.update(), 0u);
+}
+
+void
+TimerQueueTest::testAlarm()
+{
+	static Queue::time_point deadline;
+	static uint8_t alarms;
+	alarms = 0;
+	Queue queue([](Queue::time_point time) { deadline = time; alarms++; });
+	Queue::Timer timer1, timer2;
+
+	queue.start(timer1, 20ms);
+	TEST_ASSERT_EQUALS(alarms, 1);
+	TEST_ASSERT_EQUALS(deadline.time_since_epoch().count(), 1020u);
+
+	// a later deadline does not reprogram the alarm
+	queue.start(timer2, 30ms);
+	TEST_ASSERT_EQUALS(alarms, 1);
+
+	queue.start(timer2, 10ms);
+	TEST_ASSERT_EQUALS(alarms, 2);
+	TEST_ASSERT_EQUALS(deadline.time_since_epoch().count(), 1010u);
+
+	test_clock::increment(10);
+	queue.update();
+	TEST_ASSERT_EQUALS(alarms, 3);
+	TEST_ASSERT_EQUALS(deadline.time_since_epoch().count(), 1020u);
+
+	queue.cancel(timer1);
+	TEST_ASSERT_EQUALS(alarms, 3);
+	queue.start(timer1, 10ms);
+	TEST_ASSERT_EQUALS(alarms, 4);
+	TEST_ASSERT_EQUALS(deadline.time_since_epoch().count(), 1020u);
+}
+
+void
+TimerQueueTest::testOverflow()
+{
+	test_clock::setTime(0xffff'fff0);
+	Queue queue;
+	Queue::Timer timer1([]{ order[0] = ++count; });
+	Queue::Timer timer2([]{ order[1] = ++count; });
+
+	queue.start(timer1, 30ms);
+	queue.start(timer2, 10ms);
+	TEST_ASSERT_EQUALS(timer2.getDeadline().time_since_epoch().count(), 0xffff'fffau);
+
+	test_clock::increment(20);
+	TEST_ASSERT_EQUALS(queue.update(), 1u);
+	TEST_ASSERT_EQUALS(order[1], 1);
+	test_clock::increment(10);
+	TEST_ASSERT_EQUALS(queue.update(), 1u);
+	TEST_ASSERT_EQUALS(order[0], 2);
+}
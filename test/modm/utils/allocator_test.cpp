@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/utils/allocator.hpp>
+#include <modm/container/linked_list.hpp>
+#include <modm/container/doubly_linked_list.hpp>
+#include <modm/container/dynamic_array.hpp>
+#include <unittest/benchmark.hpp>
+
+#include "allocator_test.hpp"
+
+namespace
+{
+	modm::allocator::SizeClassPool<4, 16, 64, 256> sizeClassPool;
+}
+
+void
+AllocatorTest::testMemoryPool()
+{
+	static modm::allocator::MemoryPool<12, 3> pool;
+	TEST_ASSERT_EQUALS(pool.getCapacity(), 3U);
+	TEST_ASSERT_EQUALS(pool.getAvailable(), 3U);
+
+	void* a = pool.allocate();
+	void* b = pool.allocate();
+	void* c = pool.allocate();
+	TEST_ASSERT_TRUE(a and b and c);
+	TEST_ASSERT_TRUE(a != b and b != c and a != c);
+	TEST_ASSERT_EQUALS(reinterpret_cast<uintptr_t>(a) % alignof(std::max_align_t), 0U);
+	TEST_ASSERT_TRUE(pool.owns(b));
+	int outside;
+	TEST_ASSERT_FALSE(pool.owns(&outside));
+
+	TEST_ASSERT_EQUALS(pool.getAvailable(), 0U);
+	TEST_ASSERT_TRUE(pool.allocate() == nullptr);
+
+	// freed blocks are reused last in, first out
+	pool.deallocate(b);
+	pool.deallocate(a);
+	TEST_ASSERT_EQUALS(pool.getAvailable(), 2U);
+	TEST_ASSERT_EQUALS(pool.allocate(), a);
+	TEST_ASSERT_EQUALS(pool.allocate(), b);
+	pool.deallocate(a);
+	pool.deallocate(b);
+	pool.deallocate(c);
+}
+
+void
+AllocatorTest::testMemoryPoolStatistics()
+{
+	static modm::allocator::MemoryPool<4, 2, 4, true> pool;
+	void* a = pool.allocate();
+	void* b = pool.allocate();
+	pool.allocate();
+	pool.deallocate(a);
+
+	TEST_ASSERT_EQUALS(pool.getStatistics().used, 1U);
+	TEST_ASSERT_EQUALS(pool.getStatistics().peak, 2U);
+	TEST_ASSERT_EQUALS(pool.getStatistics().failures, 1U);
+
+	pool.resetStatistics();
+	TEST_ASSERT_EQUALS(pool.getStatistics().peak, 1U);
+	TEST_ASSERT_EQUALS(pool.getStatistics().failures, 0U);
+	pool.deallocate(b);
+	TEST_ASSERT_EQUALS(pool.getStatistics().used, 0U);
+}
+
+void
+AllocatorTest::testPoolLinkedList()
+{
+	using Allocator = modm::allocator::Pool<int16_t, 8>;
+	// the pool is shared by all lists of this type
+	for (uint8_t round = 0; round < 3; ++round)
+	{
+		modm::LinkedList<int16_t, Allocator> first;
+		modm::LinkedList<int16_t, Allocator> second;
+		for (int16_t ii = 0; ii < 4; ++ii)
+		{
+			first.append(ii);
+			second.prepend(ii);
+		}
+		TEST_ASSERT_EQUALS(first.getSize(), 4U);
+		TEST_ASSERT_EQUALS(first.getBack(), 3);
+		TEST_ASSERT_EQUALS(second.getFront(), 3);
+
+		first.removeFront();
+		second.append(10);
+		TEST_ASSERT_EQUALS(second.getBack(), 10);
+	}
+}
+
+void
+AllocatorTest::testPoolDoublyLinkedList()
+{
+	modm::DoublyLinkedList<int16_t, modm::allocator::Pool<int16_t, 4, true>> list;
+	for (uint8_t round = 0; round < 10; ++round)
+	{
+		for (int16_t ii = 0; ii < 4; ++ii) list.append(ii);
+		TEST_ASSERT_EQUALS(list.getBack(), 3);
+		list.removeBack();
+		list.removeFront();
+		TEST_ASSERT_EQUALS(list.getFront(), 1);
+		list.removeFront();
+		list.removeFront();
+		TEST_ASSERT_TRUE(list.isEmpty());
+	}
+}
+
+void
+AllocatorTest::testSizeClassPool()
+{
+	static modm::allocator::SizeClassPool<1, 8, 32> pool;
+	void* small = pool.allocate(4);
+	void* fallback = pool.allocate(8);
+	TEST_ASSERT_TRUE(small and fallback);
+	TEST_ASSERT_TRUE(pool.allocate(1) == nullptr);
+	TEST_ASSERT_TRUE(pool.allocate(33) == nullptr);
+	TEST_ASSERT_EQUALS(pool.getStatistics(0).used, 1U);
+	TEST_ASSERT_EQUALS(pool.getStatistics(1).used, 1U);
+	TEST_ASSERT_EQUALS(pool.getStatistics(1).failures, 1U);
+
+	// blocks are returned to their own size class
+	pool.deallocate(fallback);
+	TEST_ASSERT_EQUALS(pool.getStatistics(1).used, 0U);
+	pool.deallocate(small);
+	TEST_ASSERT_EQUALS(pool.getStatistics(0).used, 0U);
+}
+
+void
+AllocatorTest::testSizeClassDynamicArray()
+{
+	{
+		modm::DynamicArray<int32_t, modm::allocator::SizeClass<int32_t, sizeClassPool>> array;
+		for (int32_t ii = 0; ii < 50; ++ii) array.append(ii);
+		TEST_ASSERT_EQUALS(array.getSize(), 50U);
+		TEST_ASSERT_EQUALS(array[49], 49);
+		TEST_ASSERT_EQUALS(sizeClassPool.getStatistics(2).used, 1U);
+
+		modm::LinkedList<int32_t, modm::allocator::SizeClass<int32_t, sizeClassPool>> list;
+		list.append(1);
+		list.append(2);
+		TEST_ASSERT_EQUALS(sizeClassPool.getStatistics(0).used, 2U);
+	}
+	for (std::size_t ii = 0; ii < 3; ++ii) {
+		TEST_ASSERT_EQUALS(sizeClassPool.getStatistics(ii).used, 0U);
+	}
+	// the array only used the smallest class for its first two buffers
+	TEST_ASSERT_EQUALS(sizeClassPool.getStatistics(0).peak, 2U);
+}
+
+void
+AllocatorTest::benchmarkLinkedListPool()
+{
+	modm::LinkedList<int16_t, modm::allocator::Pool<int16_t, 16>> list;
+	TEST_BENCHMARK("LinkedList Pool", 1000, {
+		for (int16_t ii = 0; ii < 16; ++ii) list.append(ii);
+		while (not list.isEmpty()) list.removeFront();
+		unittest::doNotOptimize(list);
+	});
+}
+
+void
+AllocatorTest::benchmarkLinkedListDynamic()
+{
+	modm::LinkedList<int16_t> list;
+	TEST_BENCHMARK("LinkedList Dynamic", 1000, {
+		for (int16_t ii = 0; ii < 16; ++ii) list.append(ii);
+		while (not list.isEmpty()) list.removeFront();
+		unittest::doNotOptimize(list);
+	});
+}
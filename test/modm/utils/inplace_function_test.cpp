@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/utils/inplace_function.hpp>
+#include <modm/utils/bind_method.hpp>
+#include <unittest/benchmark.hpp>
+#include <functional>
+
+#include "inplace_function_test.hpp"
+
+namespace
+{
+	struct Counter
+	{
+		uint32_t count = 0;
+
+		void
+		add(uint32_t value)
+		{ count += value; }
+
+		uint32_t
+		get() const
+		{ return count; }
+	};
+
+	void
+	addCounter(void *context, uint32_t value)
+	{ static_cast<Counter*>(context)->add(value); }
+
+	Counter counter;
+	void (*rawCallback)(void*, uint32_t) = addCounter;
+	void *rawContext = &counter;
+	modm::inplace_function<void(uint32_t)> inplaceCallback = modm::bind_method<&Counter::add>(&counter);
+	std::function<void(uint32_t)> stdCallback = [object = &counter](uint32_t value) { object->add(value); };
+}
+
+void
+InplaceFunctionTest::testDefaultCapacity()
+{
+	using Function = modm::inplace_function<void()>;
+	TEST_ASSERT_EQUALS(Function::capacity::value, MODM_INPLACE_FUNCTION_STORAGE);
+
+	// a bound method only stores the object pointer
+	Counter object;
+	auto bound = modm::bind_method<&Counter::add>(&object);
+	TEST_ASSERT_EQUALS(sizeof(bound), sizeof(void*));
+}
+
+void
+InplaceFunctionTest::testBindMethod()
+{
+	Counter object;
+	modm::inplace_function<void(uint32_t)> function;
+	TEST_ASSERT_FALSE(bool(function));
+
+	function = modm::bind_method<&Counter::add>(&object);
+	TEST_ASSERT_TRUE(bool(function));
+	function(3);
+	function(4);
+	TEST_ASSERT_EQUALS(object.count, 7u);
+
+	// arguments are converted to the parameters of the method
+	modm::inplace_function<void(uint8_t)> narrow = modm::bind_method<&Counter::add>(&object);
+	narrow(uint8_t(200));
+	TEST_ASSERT_EQUALS(object.count, 207u);
+}
+
+void
+InplaceFunctionTest::testBindConstMethod()
+{
+	Counter object{42};
+	const Counter *constant = &object;
+	modm::inplace_function<uint32_t()> function = modm::bind_method<&Counter::get>(constant);
+	TEST_ASSERT_EQUALS(function(), 42u);
+
+	object.add(1);
+	TEST_ASSERT_EQUALS(function(), 43u);
+}
+
+void
+InplaceFunctionTest::testCopyAndMove()
+{
+	Counter first, second;
+	modm::inplace_function<void(uint32_t)> function = modm::bind_method<&Counter::add>(&first);
+	modm::inplace_function<void(uint32_t)> copy = function;
+	copy(1);
+	function(2);
+	TEST_ASSERT_EQUALS(first.count, 3u);
+
+	// larger storage accepts smaller functions
+	modm::inplace_function<void(uint32_t), 4 * sizeof(void*)> larger = std::move(copy);
+	TEST_ASSERT_FALSE(bool(copy));
+	larger(4);
+	TEST_ASSERT_EQUALS(first.count, 7u);
+
+	function = modm::bind_method<&Counter::add>(&second);
+	function(5);
+	TEST_ASSERT_EQUALS(first.count, 7u);
+	TEST_ASSERT_EQUALS(second.count, 5u);
+}
+
+void
+InplaceFunctionTest::benchmarkRawPointer()
+{
+	TEST_BENCHMARK("Raw Pointer", 1000, {
+		rawCallback(rawContext, 1);
+		unittest::doNotOptimize(counter);
+	});
+}
+
+void
+InplaceFunctionTest::benchmarkInplaceFunction()
+{
+	TEST_BENCHMARK("inplace_function", 1000, {
+		inplaceCallback(1);
+		unittest::doNotOptimize(counter);
+	});
+}
+
+void
+InplaceFunctionTest::benchmarkStdFunction()
+{
+	TEST_BENCHMARK("std::function", 1000, {
+		stdCallback(1);
+		unittest::doNotOptimize(counter);
+	});
+}
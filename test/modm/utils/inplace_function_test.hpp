@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026, Niklas Hauser
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_utils
+class InplaceFunctionTest : public unittest::TestSuite
+{
+public:
+	void
+	testDefaultCapacity();
+
+	void
+	testBindMethod();
+
+	void
+	testBindConstMethod();
+
+	void
+	testCopyAndMove();
+
+	void
+	benchmarkRawPointer();
+
+	void
+	benchmarkInplaceFunction();
+
+	void
+	benchmarkStdFunction();
+};
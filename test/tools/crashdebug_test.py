@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2026, Niklas Hauser
+#
+# This file is part of the modm project.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# -----------------------------------------------------------------------------
+
+import struct, unittest
+from modm_tools import crashdebug
+
+
+def make_buffer(events, capacity=4, frequency=1000, head=None):
+    """Builds a `modm::trace::Buffer` as written by `modm::trace::record()`."""
+    slots = [struct.pack("<IIII", 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff)] * capacity
+    for index, (timestamp, id, arg0, arg1) in enumerate(events):
+        tag = ((index & 0xffff) << 16) | id
+        slots[index % capacity] = struct.pack("<IIII", timestamp, tag, arg0, arg1)
+    head = len(events) if head is None else head
+    return (struct.pack("<IHHII", crashdebug.TRACE_MAGIC, 1, capacity, frequency, head) +
+            b"".join(slots))
+
+
+class CrashDebugTest(unittest.TestCase):
+
+    def test_decode(self):
+        data = make_buffer([(100, 0xffff, 1, 0), (600, 7, 0x12, 0x34)])
+        frequency, events = crashdebug.decode_trace(b"\0" * 12 + data)
+        self.assertEqual(frequency, 1000)
+        self.assertEqual([e.id for e in events], [0xffff, 7])
+        self.assertEqual(events[1].arg0, 0x12)
+        self.assertEqual(events[1].arg1, 0x34)
+        self.assertAlmostEqual(events[1].time, 0.5)
+
+    def test_wrap_and_reset(self):
+        data = make_buffer([(0, 1, 0, 0), (10, 2, 0, 0),
+                            (0xfffffff0, 3, 0, 0), (0x10, 4, 0, 0),
+                            (5, 0xffff, 0, 0), (25, 5, 0, 0)])
+        frequency, events = crashdebug.decode_trace(data)
+        self.assertEqual([e.index for e in events], [2, 3, 4, 5])
+        # the counter overflowed between events 2 and 3, but not over a reset
+        self.assertAlmostEqual(events[1].time, 0.032)
+        self.assertAlmostEqual(events[2].time, 0.032)
+        self.assertAlmostEqual(events[3].time, 0.052)
+
+    def test_torn_event(self):
+        # the reset happened after the head was incremented, but before the
+        # event was completely written
+        data = make_buffer([(1, 1, 0, 0), (2, 2, 0, 0)], head=3)
+        _, events = crashdebug.decode_trace(data)
+        self.assertEqual([e.id for e in events], [1, 2])
+
+    def test_coredump(self):
+        data = make_buffer([(1, 42, 0xdeadbeef, 0)])
+        text = "###CRASH###\r\n63430300\r\n" + data.hex() + "\r\n###END###\r\n"
+        data = crashdebug.parse_coredump(text.encode())
+        frequency, events = crashdebug.decode_trace(data)
+        self.assertEqual(events[0].arg0, 0xdeadbeef)
+        output = crashdebug.format_trace(frequency, events, {42: "Sensor"})
+        self.assertIn("Sensor", output)
+        self.assertIn("0xdeadbeef", output)
+
+    def test_no_trace(self):
+        self.assertIsNone(crashdebug.decode_trace(bytes(64)))
+        # wrong version
+        data = bytearray(make_buffer([(1, 1, 0, 0)]))
+        data[4] = 2
+        self.assertIsNone(crashdebug.decode_trace(bytes(data)))
+
+
+if __name__ == "__main__":
+    unittest.main()
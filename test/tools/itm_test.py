@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2026, Niklas Hauser
+#
+# This file is part of the modm project.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# -----------------------------------------------------------------------------
+
+import unittest
+from modm_tools import itm
+
+# SWO recording of a Cortex-M4 with PC sampling, exception trace and fiber
+# events enabled, ending in a truncated PC sample packet.
+CAPTURE = bytes.fromhex(
+    "0000000000 80"     # synchronization
+    "01 48"             # stimulus port 0: 'H'
+    "0b 00010020"       # stimulus port 1: fiber 0x20000100
+    "17 04010008"       # PC sample: 0x08000104
+    "15 00"             # PC sample: sleeping
+    "0e 1510"           # exception trace: enter IRQ5
+    "17 04020008"       # PC sample: 0x08000204
+    "0e 1520"           # exception trace: exit IRQ5
+    "0e 0030"           # exception trace: return to thread
+    "30"                # local timestamp format 2: 3
+    "c0 8101"           # local timestamp format 1: 129
+    "70"                # overflow
+    "0b 00020020"       # stimulus port 1: fiber 0x20000200
+    "17 08010008"       # PC sample: 0x08000108
+    "17 04"             # truncated
+)
+
+FUNCTIONS = itm.Symbols([(0x08000100, 0x10, "main"),
+                         (0x08000200, 0x20, "TIM2_IRQHandler")])
+OBJECTS = itm.Symbols([(0x20000100, 64, "fiber1"),
+                       (0x20000200, 64, "fiber2")])
+
+
+class ItmTest(unittest.TestCase):
+    def test_decode(self):
+        packets = list(itm.decode(CAPTURE))
+        self.assertEqual([p.kind for p in packets],
+                         ["sync", "stimulus", "stimulus", "hardware", "hardware",
+                          "hardware", "hardware", "hardware", "hardware",
+                          "timestamp", "timestamp", "overflow", "stimulus", "hardware"])
+        self.assertEqual(packets[1], itm.Packet("stimulus", 0, ord("H"), 1))
+        self.assertEqual(packets[2], itm.Packet("stimulus", 1, 0x20000100, 4))
+        self.assertEqual(packets[3], itm.Packet("hardware", 2, 0x08000104, 4))
+        self.assertEqual(packets[4], itm.Packet("hardware", 2, 0, 1))
+        self.assertEqual(packets[5], itm.Packet("hardware", 1, 0x1015, 2))
+        self.assertEqual(packets[9].value, 3)
+        self.assertEqual(packets[10].value, 129)
+
+    def test_resynchronize(self):
+        packets = list(itm.decode(bytes.fromhex("80 a0 01 41")))
+        self.assertEqual(packets, [itm.Packet("stimulus", 0, ord("A"), 1)])
+
+    def test_symbols(self):
+        self.assertEqual(FUNCTIONS.lookup(0x08000100), "main")
+        self.assertEqual(FUNCTIONS.lookup(0x0800010f), "main")
+        self.assertIsNone(FUNCTIONS.lookup(0x08000110))
+        self.assertIsNone(FUNCTIONS.lookup(0x080000ff))
+
+    def test_profile(self):
+        result = itm.profile(itm.decode(CAPTURE), FUNCTIONS, OBJECTS)
+        self.assertEqual(result.samples, 4)
+        self.assertEqual(result.sleeping, 1)
+        self.assertEqual(result.unknown, 0)
+        self.assertEqual(result.overflows, 1)
+        self.assertEqual(result.functions, {"main": 2, "TIM2_IRQHandler": 1})
+        self.assertEqual(result.exceptions, {"Thread": 2, "IRQ5": 1})
+        self.assertEqual(result.fibers, {"fiber1": 1, "fiber2": 1})
+        self.assertEqual(result.entries, {"IRQ5": 1})
+        self.assertEqual(result.switches, {"fiber1": 1, "fiber2": 1})
+
+    def test_profile_without_symbols(self):
+        result = itm.profile(itm.decode(CAPTURE))
+        self.assertEqual(result.functions["0x08000104"], 1)
+        self.assertEqual(result.fibers, {"0x20000100": 1, "0x20000200": 1})
+        self.assertIn("Samples: 4 (1 sleeping, 0 unknown), overflows: 1",
+                      itm.format_profile(result))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -1,7 +1,7 @@
 #!/usr/bin/env python3
 # -*- coding: utf-8 -*-
 #
-# Copyright (c) 2020, 2023, Niklas Hauser
+# Copyright (c) 2020, 2023, 2026, Niklas Hauser
 #
 # This file is part of the modm project.
 #
@@ -10,10 +10,110 @@
 # file, You can obtain one at http://mozilla.org/MPL/2.0/.
 # -----------------------------------------------------------------------------
 
-import os, platform
+"""
+### CrashDebug
+
+Post-mortem debugging of a CrashCatcher coredump via GDB is provided by the
+`modm_tools.gdb` module with the `crashdebug` backend. If the coredump contains
+the trace buffer of the `modm:debug:trace` module, the events are printed
+before GDB is started.
+
+You can also decode the trace of a coredump or of a hosted trace file directly:
+
+```sh
+python3 -m modm_tools.crashdebug coredump.txt
+```
+"""
+
+import os, re, struct, platform
+from collections import namedtuple
+from pathlib import Path
 from .backend import DebugBackend
 
 
+# -----------------------------------------------------------------------------
+TRACE_MAGIC = 0x4352544d
+TRACE_ID_RESET = 0xffff
+
+TraceEvent = namedtuple("TraceEvent", ["index", "timestamp", "time", "id", "arg0", "arg1"])
+TraceEvent.__doc__ = """\
+A decoded `modm::trace::Event`, with `time` in seconds since the first event."""
+
+
+def parse_coredump(content):
+    """
+    Converts the coredump into bytes.
+
+    :param content: the raw bytes of a hosted trace file or the text of a
+                    CrashCatcher coredump with hexadecimal bytes.
+    """
+    if any(b not in b"\t\r\n" and not 0x20 <= b < 0x7f for b in content):
+        return content
+    text = content.decode("ascii")
+    # Skip the markers around the hexadecimal coredump
+    text = re.sub(r"###.*?###", "", text)
+    digits = re.sub(r"[^0-9a-fA-F]", "", text)
+    if len(digits) % 2: digits = digits[:-1]
+    return bytes.fromhex(digits)
+
+
+def decode_trace(data):
+    """
+    Finds and decodes the `modm::trace::Buffer` in the data.
+
+    Events interrupted by a reset or fault are discarded, since their sequence
+    number does not match their position in the ring buffer.
+
+    :returns: tuple of the frequency in Hz and the list of `TraceEvent`s from
+              the oldest to the newest event, or `None` if no buffer was found.
+    """
+    offset = 0
+    while (offset := data.find(struct.pack("<I", TRACE_MAGIC), offset)) >= 0:
+        header = data[offset:offset + 16]
+        if len(header) < 16: return None
+        _, version, capacity, frequency, head = struct.unpack("<IHHII", header)
+        size = 16 + 16 * capacity
+        if (version != 1 or not capacity or capacity & (capacity - 1) or
+                not frequency or len(data) < offset + size):
+            offset += 4
+            continue
+
+        events = []
+        count = min(head, capacity)
+        for index in range(head - count, head):
+            slot = offset + 16 + 16 * (index % capacity)
+            timestamp, tag, arg0, arg1 = struct.unpack("<IIII", data[slot:slot + 16])
+            if (tag >> 16) != (index & 0xffff):
+                continue
+            events.append([index, timestamp, tag & 0xffff, arg0, arg1])
+
+        # accumulate the time over timestamp overflows, resets do not advance
+        # the time, since the counter restarts from an unknown value.
+        result, time, last = [], 0, None
+        for index, timestamp, id, arg0, arg1 in events:
+            if last is not None and id != TRACE_ID_RESET:
+                time += ((timestamp - last) & 0xffffffff) / frequency
+            last = timestamp
+            result.append(TraceEvent(index, timestamp, time, id, arg0, arg1))
+        return (frequency, result)
+    return None
+
+
+def format_trace(frequency, events, names=None):
+    """
+    :param names: optional dictionary of event IDs to names.
+    """
+    names = dict(names or {})
+    names.setdefault(TRACE_ID_RESET, "Reset")
+    lines = ["Trace: {} events at {} Hz".format(len(events), frequency),
+             "{:>8}  {:>14}  {:<16}  {:>10}  {:>10}".format("#", "time [s]", "id", "arg0", "arg1")]
+    for event in events:
+        lines.append("{:8d}  {:14.9f}  {:<16}  0x{:08x}  0x{:08x}".format(
+                     event.index, event.time, names.get(event.id, str(event.id)),
+                     event.arg0, event.arg1))
+    return "\n".join(lines)
+
+
 class CrashDebugBackend(DebugBackend):
     def __init__(self, coredump):
         super().__init__()
@@ -23,6 +123,14 @@ class CrashDebugBackend(DebugBackend):
             self.binary = "CrashDebug.exe"
         self.binary = os.environ.get("MODM_CRASHDEBUG_BINARY", self.binary)
 
+    def start(self):
+        try:
+            trace = decode_trace(parse_coredump(Path(self.coredump).read_bytes()))
+        except OSError:
+            trace = None
+        if trace is not None:
+            print(format_trace(*trace), end="\n\n")
+
     def init(self, elf):
         return ["set target-charset ASCII",
                 "target remote | {} --elf {} --dump {}"
@@ -39,3 +147,26 @@ def add_subparser(subparser):
     parser.set_defaults(backend=lambda args: CrashDebugBackend(args.coredump))
     return parser
 
+
+# -----------------------------------------------------------------------------
+if __name__ == "__main__":
+    import argparse, json
+
+    parser = argparse.ArgumentParser(description="Decode the event trace of a coredump.")
+    parser.add_argument(
+            dest="coredump",
+            help="CrashCatcher coredump or hosted trace file.")
+    parser.add_argument(
+            "--names",
+            dest="names",
+            help="JSON file mapping event IDs to names.")
+
+    args = parser.parse_args()
+    trace = decode_trace(parse_coredump(Path(args.coredump).read_bytes()))
+    if trace is None:
+        print("No trace found in '{}'!".format(args.coredump))
+        exit(1)
+    names = None
+    if args.names:
+        names = {int(k, 0): v for k, v in json.loads(Path(args.names).read_text()).items()}
+    print(format_trace(*trace, names))
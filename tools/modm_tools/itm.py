@@ -1,7 +1,7 @@
 #!/usr/bin/env python3
 # -*- coding: utf-8 -*-
 #
-# Copyright (c) 2023, Niklas Hauser
+# Copyright (c) 2023, 2026, Niklas Hauser
 #
 # This file is part of the modm project.
 #
@@ -27,11 +27,249 @@ JLink is also supported and can determine the CPU frequency automatically:
 python3 -m modm_tools.itm jlink -device STM32F469NI
 ```
 
+#### Statistical Profiling
+
+The `modm:platform:itm` module can configure the DWT to periodically sample the
+program counter and to trace interrupt entry and exit, which are then
+transmitted over SWO together with the fiber switch events on stimulus port 1,
+if enabled via the `modm:platform:itm:trace.fiber` option:
+
+```cpp
+Itm::initialize();
+Itm::enablePcSampling(4096); // every 4096 CPU cycles
+Itm::enableExceptionTrace();
+```
+
+Record the raw SWO stream to a file with OpenOCD:
+
+```sh
+openocd -f modm/openocd.cfg -c "modm_itm_log capture.swo 64000000"
+```
+
+Then decode the recording into a flat profile of the functions and fibers in
+the ELF file, and the number of entries into each interrupt:
+
+```sh
+python3 -m modm_tools.itm profile capture.swo --elf path/to/project.elf
+
+Samples: 1024 (12 sleeping, 0 unknown), overflows: 0
+
+Functions:
+  61.2%    627  modm::platform::Uart2::writeBlocking(unsigned char)
+  ...
+```
+
 (\* *only ARM Cortex-M targets*)
 """
 
+import bisect
+import shutil
+import subprocess
+from collections import Counter, namedtuple
+from pathlib import Path
+
 from . import openocd, jlink
 
+
+# -----------------------------------------------------------------------------
+Packet = namedtuple("Packet", ["kind", "address", "value", "size"])
+Packet.__doc__ = """\
+A decoded ITM packet. `kind` is one of "sync", "overflow", "timestamp",
+"stimulus" for software sources or "hardware" for DWT sources with their
+`address` being the port or the discriminator ID."""
+
+EXCEPTION_NAMES = {1: "Reset", 2: "NMI", 3: "HardFault", 4: "MemManage",
+                   5: "BusFault", 6: "UsageFault", 7: "SecureFault",
+                   11: "SVCall", 12: "DebugMon", 14: "PendSV", 15: "SysTick"}
+
+def exception_name(number):
+    if number == 0: return "Thread"
+    if number >= 16: return "IRQ{}".format(number - 16)
+    return EXCEPTION_NAMES.get(number, "Exception{}".format(number))
+
+
+def decode(data):
+    """
+    Decodes a raw SWO byte stream into ITM packets.
+    Truncated packets at the end of the stream are ignored.
+
+    :param data: bytes of the SWO stream without TPIU framing.
+    :returns: generator of `Packet`s.
+    """
+    index, length = 0, len(data)
+
+    def continuation(index):
+        # returns the index after the last byte with the continuation bit set
+        while index < length and data[index] & 0x80:
+            index += 1
+        return index + 1
+
+    while index < length:
+        header = data[index]
+        if header == 0x00:
+            # synchronization: at least 47 zero bits followed by a one bit
+            while index < length and data[index] == 0x00:
+                index += 1
+            if index < length and data[index] == 0x80:
+                yield Packet("sync", 0, 0, 0)
+            index += 1
+        elif header == 0x70:
+            yield Packet("overflow", 0, 0, 0)
+            index += 1
+        elif header & 0x0f == 0x00 and header & 0xc0 != 0x80:
+            # local timestamp in format 1 with continuation or format 2
+            if header & 0xc0 == 0xc0:
+                end = continuation(index + 1)
+                if end > length: return
+                value = 0
+                for shift, byte in enumerate(data[index + 1:end]):
+                    value |= (byte & 0x7f) << (7 * shift)
+                index = end
+            else:
+                value = (header >> 4) & 0x07
+                index += 1
+            yield Packet("timestamp", 0, value, 0)
+        elif header & 0xdf == 0x94:
+            # global timestamp is not used
+            index = continuation(index + 1) if header & 0x80 else index + 1
+        elif header & 0x0b == 0x08:
+            # extension packet is not used
+            index = continuation(index + 1) if header & 0x80 else index + 1
+        elif header & 0x03:
+            size = {1: 1, 2: 2, 3: 4}[header & 0x03]
+            if index + 1 + size > length: return
+            value = int.from_bytes(data[index + 1:index + 1 + size], "little")
+            kind = "hardware" if header & 0x04 else "stimulus"
+            yield Packet(kind, header >> 3, value, size)
+            index += 1 + size
+        else:
+            # reserved header, skip to resynchronize
+            index += 1
+
+
+class Symbols:
+    """
+    Maps addresses to symbol names.
+
+    :param symbols: iterable of (address, size, name) tuples.
+    """
+    def __init__(self, symbols):
+        self.symbols = sorted((a, a + max(s, 1), n) for a, s, n in symbols)
+        self.starts = [s[0] for s in self.symbols]
+
+    def lookup(self, address):
+        index = bisect.bisect_right(self.starts, address) - 1
+        if index >= 0 and address < self.symbols[index][1]:
+            return self.symbols[index][2]
+        return None
+
+    @staticmethod
+    def from_elf(path):
+        """
+        :returns: a tuple of the function and object `Symbols` of the ELF file.
+        """
+        from elftools.elf.elffile import ELFFile
+        functions, objects = [], []
+        with open(path, "rb") as src:
+            for section in ELFFile(src).iter_sections():
+                if section.header.sh_type != "SHT_SYMTAB":
+                    continue
+                for symbol in section.iter_symbols():
+                    kind = symbol["st_info"]["type"]
+                    if kind == "STT_FUNC":
+                        functions.append((symbol["st_value"] & ~1, symbol["st_size"], symbol.name))
+                    elif kind == "STT_OBJECT":
+                        objects.append((symbol["st_value"], symbol["st_size"], symbol.name))
+        return (Symbols(_demangle(functions)), Symbols(_demangle(objects)))
+
+
+def _demangle(symbols):
+    cxxfilt = shutil.which("arm-none-eabi-c++filt") or shutil.which("c++filt")
+    if not cxxfilt or not symbols:
+        return symbols
+    names = subprocess.run([cxxfilt], input="\n".join(s[2] for s in symbols),
+                           capture_output=True, text=True).stdout.splitlines()
+    if len(names) != len(symbols):
+        return symbols
+    return [(a, s, n) for (a, s, _), n in zip(symbols, names)]
+
+
+Profile = namedtuple("Profile", ["samples", "sleeping", "unknown", "overflows",
+                                 "functions", "exceptions", "fibers", "entries", "switches"])
+Profile.__doc__ = """\
+The flat profile of a SWO recording. `functions`, `exceptions` and `fibers`
+count the PC samples per name, `entries` counts the exception entries and
+`switches` the fiber switches per name."""
+
+def profile(packets, functions=None, objects=None, fiber_port=1):
+    """
+    Accumulates the PC samples, exception trace and fiber events into a profile.
+
+    :param packets: iterable of decoded `Packet`s.
+    :param functions: `Symbols` to resolve the sampled PC, otherwise the
+                      address is used as name.
+    :param objects: `Symbols` to resolve fiber task addresses.
+    :param fiber_port: stimulus port of the fiber switch events.
+    """
+    result = Profile(0, 0, 0, 0, Counter(), Counter(), Counter(), Counter(), Counter())
+    samples = sleeping = unknown = overflows = 0
+    exception, fiber = 0, None
+
+    def name(symbols, address):
+        found = symbols.lookup(address) if symbols else None
+        return found or "0x{:08x}".format(address)
+
+    for packet in packets:
+        if packet.kind == "overflow":
+            overflows += 1
+        elif packet.kind == "stimulus" and packet.address == fiber_port and packet.size == 4:
+            fiber = name(objects, packet.value) if packet.value else None
+            if fiber: result.switches[fiber] += 1
+        elif packet.kind == "hardware" and packet.address == 1 and packet.size == 2:
+            number, function = packet.value & 0x1ff, (packet.value >> 12) & 0x3
+            if function == 1:
+                exception = number
+                result.entries[exception_name(number)] += 1
+            elif function == 3:
+                exception = number
+        elif packet.kind == "hardware" and packet.address == 2:
+            samples += 1
+            if packet.size == 1:
+                # the core was sleeping
+                sleeping += 1
+                continue
+            function = functions.lookup(packet.value) if functions else None
+            if functions and function is None:
+                unknown += 1
+            result.functions[function or "0x{:08x}".format(packet.value)] += 1
+            result.exceptions[exception_name(exception)] += 1
+            if exception == 0 and fiber:
+                result.fibers[fiber] += 1
+
+    return result._replace(samples=samples, sleeping=sleeping,
+                           unknown=unknown, overflows=overflows)
+
+
+def format_profile(result, limit=None):
+    lines = ["Samples: {} ({} sleeping, {} unknown), overflows: {}".format(
+             result.samples, result.sleeping, result.unknown, result.overflows)]
+    total = max(result.samples, 1)
+    def table(title, counter, limit=None):
+        if not counter: return
+        lines.extend(["", title + ":"])
+        for name, count in counter.most_common(limit):
+            lines.append("{:6.1f}% {:6d}  {}".format(100 * count / total, count, name))
+    table("Functions", result.functions, limit)
+    table("Exceptions", result.exceptions)
+    table("Fibers", result.fibers)
+    if result.entries:
+        lines.extend(["", "Exception entries:"])
+        lines.extend("{:14d}  {}".format(c, n) for n, c in result.entries.most_common())
+    if result.switches:
+        lines.extend(["", "Fiber switches:"])
+        lines.extend("{:14d}  {}".format(c, n) for n, c in result.switches.most_common())
+    return "\n".join(lines)
+
 if __name__ == "__main__":
     import argparse
 
@@ -47,6 +285,22 @@ if __name__ == "__main__":
 
     # Add backends
     jlink.add_subparser(subparsers)
+    parser_profile = subparsers.add_parser("profile",
+            help="Decode a recorded SWO stream into a flat profile.")
+    parser_profile.add_argument(
+            dest="capture",
+            help="The raw SWO recording.")
+    parser_profile.add_argument(
+            "--elf",
+            dest="elf",
+            help="Resolve the function and fiber names from this ELF file.")
+    parser_profile.add_argument(
+            "-n", "--limit",
+            dest="limit",
+            type=int,
+            default=None,
+            help="Only show the functions with the most samples.")
+    parser_profile.set_defaults(backend=lambda args: None)
     parser_openocd = openocd.add_subparser(subparsers)
     parser_openocd.add_argument(
             "--fcpu",
@@ -57,7 +311,11 @@ if __name__ == "__main__":
     args = parser.parse_args()
     backend = args.backend(args)
 
-    if isinstance(backend, openocd.OpenOcdBackend):
+    if backend is None:
+        symbols = Symbols.from_elf(args.elf) if args.elf else (None, None)
+        result = profile(decode(Path(args.capture).read_bytes()), *symbols)
+        print(format_profile(result, args.limit))
+    elif isinstance(backend, openocd.OpenOcdBackend):
         openocd.itm(backend, fcpu=args.fcpu, baudrate=args.baudrate)
     elif isinstance(backend, jlink.JLinkBackend):
         jlink.itm(args.device, baudrate=args.baudrate)
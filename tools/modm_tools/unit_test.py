@@ -22,15 +22,24 @@ python3 -m modm_tools.unit_test path/containing/tests path/to/generated_runner.c
 
 Note that the files containing unittests must contain *one* class that inherits
 from the `unittest::TestSuite` class, and test case names must begin with
-`test`:
+`test`. Benchmark cases must begin with `benchmark` and are run after all test
+cases of the test suite:
 
 ```cpp
 class TestClass : public unittest::TestSuite
 {
 public:
     void testCase1();
+    void benchmarkCase1();
 }
 ```
+
+The benchmark results can be extracted from the output of the test runner to
+track regressions:
+
+```sh
+python3 -m modm_tools.unit_test --parse test_output.log
+```
 """
 
 import re
@@ -69,6 +78,12 @@ int run_modm_unit_test()
         {{test.instance}}.{{test_case}}();
         {{test.instance}}.tearDown();
     {% endfor %}
+    {% for benchmark in test.benchmarks %}
+
+        {{test.instance}}.setUp();
+        {{test.instance}}.{{benchmark}}();
+        {{test.instance}}.tearDown();
+    {% endfor %}
     }
 {% endfor %}
 
@@ -92,7 +107,9 @@ def extract_tests(headers):
 
         functions = re.findall(
             r"void\s+(test[_a-zA-Z]\w*)\s*\([\svoid]*\)\s*;", content)
-        if not functions:
+        benchmarks = re.findall(
+            r"void\s+(benchmark[_a-zA-Z]\w*)\s*\([\svoid]*\)\s*;", content)
+        if not functions and not benchmarks:
             print("No tests found in {}!".format(header))
 
         tests.append({
@@ -101,6 +118,7 @@ def extract_tests(headers):
             "class": name,
             "instance": name[0].lower() + name[1:],
             "test_cases": functions,
+            "benchmarks": benchmarks,
         })
 
     return sorted(tests, key=lambda t: t["file"])
@@ -115,6 +133,28 @@ def render_runner(headers, destination=None):
     return content
 
 
+def parse_benchmarks(output):
+    """
+    Extracts the benchmark results from the test runner output.
+
+    :param output: text printed by the test runner.
+    :returns: dictionary of "suite:name" keys to dictionaries of the
+              `iterations`, `repetitions`, `min`, `median`, `max` and `unit`.
+    """
+    results = {}
+    for line in output.splitlines():
+        match = re.search(r"BENCH: (\S+) (.*)", line)
+        if not match:
+            continue
+        values = dict(f.split("=", 1) for f in match.group(2).split())
+        for key in ("iterations", "repetitions"):
+            values[key] = int(values[key])
+        for key in ("min", "median", "max"):
+            values[key] = float(values[key])
+        results[match.group(1)] = values
+    return results
+
+
 # -----------------------------------------------------------------------------
 if __name__ == "__main__":
     import argparse
@@ -128,7 +168,16 @@ if __name__ == "__main__":
             dest="destination",
             default="unittest_runner.cpp",
             help="Generated runner file.")
+    parser.add_argument(
+            "--parse",
+            action="store_true",
+            help="Print the benchmark results of a test runner log in `path` as JSON.")
 
     args = parser.parse_args()
+    if args.parse:
+        import json
+        print(json.dumps(parse_benchmarks(Path(args.path).read_text()), indent=4))
+        exit(0)
+
     headers = find_files.scan(args.path, ["_test"+h for h in find_files.HEADER])
     render_runner(headers, args.destination)
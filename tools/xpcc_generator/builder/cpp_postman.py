@@ -74,7 +74,24 @@ class PostmanBuilder(builder_base.Builder):
 					if action.parameterType is not None:
 						resumableActionsWithPayload += 1
 
+		# all payload types delivered by this postman, checked at compile time
+		payloadTypes = []
+		def addPayloadType(payload, prefixed):
+			if payload is None: return
+			name = filter.typeName(payload.name)
+			if prefixed:
+				name = namespace + "::packet::" + name
+			if name not in payloadTypes:
+				payloadTypes.append(name)
+		for component in components:
+			for action in component.actions:
+				if action.parameterType is not None:
+					addPayloadType(action.parameterType, not action.parameterType.isBuiltIn)
+		for event in container.events.subscribe:
+			addPayloadType(self.tree.events[event.name].type, True)
+
 		substitutions = {
+			'payloadTypes': payloadTypes,
 			'resumables': resumableActions,
 			'resumablePayloads': resumableActionsWithPayload,
 			'components': components,
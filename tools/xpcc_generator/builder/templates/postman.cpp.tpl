@@ -21,6 +21,13 @@
 
 #include "identifier.hpp"
 #include "postman.hpp"
+#include <type_traits>
+{% for type in payloadTypes %}
+static_assert(std::is_trivially_copyable_v<{{ type }}>,
+		"xpcc payload '{{ type }}' must be trivially copyable!");
+static_assert(sizeof({{ type }}) < 0xffff,
+		"xpcc payload '{{ type }}' is too large!");
+{%- endfor %}
 
 namespace component
 {
@@ -52,8 +59,9 @@ Postman::deliverPacket(const xpcc::Header& header, const modm::SmartPointer& pay
 	{%- for action in component.actions %}
 		{%- if action.parameterType != None %}
 			{%- set typePrefix = "" if action.parameterType.isBuiltIn else namespace ~ "::packet::" %}
-			{%- set payload = ", payload.get<" ~ typePrefix ~ (action.parameterType.name | CamelCase) ~ ">()" %}
-			{%- set arguments = "const " ~ typePrefix ~ (action.parameterType.name | CamelCase) ~ "& payload" %}
+			{%- set payloadType = typePrefix ~ (action.parameterType.name | CamelCase) %}
+			{%- set payload = ", payload.get<" ~ payloadType ~ ">()" %}
+			{%- set arguments = "const " ~ payloadType ~ "& payload" %}
 			{%- set pointer = ", payload" %}
 		{%- else %}
 			{%- set payload = "" %}
@@ -66,6 +74,12 @@ Postman::deliverPacket(const xpcc::Header& header, const modm::SmartPointer& pay
 			{%- set returns = "void" %}
 		{%- endif %}
 				case {{ namespace }}::action::{{ action.name | CAMELCASE }}:
+		{%- if action.parameterType != None %}
+					// reject the payload before dispatching if the size does not match
+					if (payload.getSize() != sizeof({{ payloadType }})) {
+						return WRONG_ACTION_PARAMETER;
+					}
+		{%- endif %}
 		{%- if action.call == "resumable" %}
 					// xpcc::ActionResponse<{{ returns }}> action{{ action.name | CamelCase }}({{ arguments }});
 					if (actionBuffer[{{ actionNumber.__len__() }}].destination != 0) {
@@ -103,6 +117,11 @@ Postman::deliverPacket(const xpcc::Header& header, const modm::SmartPointer& pay
 			{
 {%- for event in container.events.subscribe %}
 				case {{ namespace }}::event::{{ event.name | CAMELCASE }}:
+	{%- if events[event.name].type != None %}
+					if (payload.getSize() != sizeof({{ namespace }}::packet::{{ events[event.name].type.name | CamelCase }})) {
+						return WRONG_EVENT_PARAMETER;
+					}
+	{%- endif %}
 	{%- for component in eventSubscriptions[event.name] %}
 		{%- if events[event.name].type != None %}
 					// void event{{ event.name | CamelCase }}(const xpcc::Header& header, const {{ namespace }}::packet::{{ events[event.name].type.name | CamelCase }} *payload);